@@ -77,7 +77,87 @@
 #define     MSF_SHORT_DELAY_API        1
 #define     MSF_PRINT_API              1
 #define     MSF_ANALOG_API             1 
-#define     MSF_SWTIMER_API            0
+/* The software timers (msf_timer_set) are driven by the SysTick.
+   Define MSF_SWTIMER_API as 1 in msf_config.h of the project which uses them. */
+#ifndef MSF_SWTIMER_API
+	#define     MSF_SWTIMER_API        0
+#endif
+
+/** Where the callbacks of the software timers are called.
+ 0 = from the SysTick interrupt (default).
+ 1 = from msf_timer_poll() which you call in the main loop.
+*/
+#ifndef MSF_SWTIMER_DEFERRED
+	#define	MSF_SWTIMER_DEFERRED	(0)
+#endif
+
+/** Tickless system time. 
+ 0 = SysTick interrupt every ms keeps the time (default).
+ 1 = the time is kept by free-running PIT (channel 0) with one interrupt per minute. 
+ With MSF_DELAY_SLEEP, msf_delay_ms sleeps until one wake-up interrupt (PIT channel 1)
+ at its end; without it, msf_delay_ms busy-waits and uses no wake-up. 
+ This reduces the number of interrupts when the CPU is idle. Requires F_BUS in msf_config.h.
+ The resolution of msf_micros is 1/F_BUS (it is worse than 1 us for F_BUS below 1 MHz).
+ */
+#ifndef MSF_TICKLESS
+	#define	MSF_TICKLESS		(0)
+#endif
+
+/** How msf_delay_ms waits.
+ 0 = busy-wait loop (default); exact wake-up timing, but full CPU power.
+ 1 = the CPU sleeps (WFI) until the next interrupt, or the idle hook registered by
+ msf_set_idle_hook is called, so that other work can run during the delay.
+ */
+#ifndef MSF_DELAY_SLEEP
+	#define	MSF_DELAY_SLEEP		(0)
+#endif
+
+/** Include msf_delay_selftest which verifies the cycle counts of the short delays. */
+#ifndef MSF_DELAY_SELFTEST
+	#define	MSF_DELAY_SELFTEST	(0)
+#endif
+
+/** Switching the CPU clock in runtime by msf_clock_set.
+ 0 = the CPU clock is always F_CPU (default).
+ 1 = the program can switch between 48, 8 and 4 MHz, e.g. drop to 4 MHz when idle.
+ The system time and the drivers are adjusted to the new clock.
+ Requires F_CPU 48 MHz (CLOCK_SETUP 1 with the 8 MHz crystal); not available in tickless mode.
+ */
+#ifndef MSF_CLOCK_SWITCH
+	#define	MSF_CLOCK_SWITCH	(0)
+#endif
+
+/** Max. difference of the UART1/2 baudrate after the clock switch from the baudrate at F_CPU,
+ in 0.1 % (default 3 %). msf_clock_set refuses the clock at which an initialized UART1/2 would exceed it. */
+#ifndef MSF_CLOCK_BAUD_TOLERANCE
+	#define	MSF_CLOCK_BAUD_TOLERANCE	(30)
+#endif
+
+/** How many functions can be registered by msf_clock_notify_add (the drivers need 2). */
+#ifndef MSF_CLOCK_NOTIFY_MAX
+	#define	MSF_CLOCK_NOTIFY_MAX	(4)
+#endif
+
+/** Low-power manager.
+ 0 = not used (default).
+ 1 = msf_lowpower_sleep puts the CPU into the deepest stop mode (VLPS or LLS) allowed by 
+ the power states of the drivers. Uses the LPTMR and defines the LPTimer_IRQHandler and 
+ LLW_IRQHandler, so it cannot be used together with FREQCNT_USE_LPTMR. Not available in tickless mode.
+ */
+#ifndef MSF_LOWPOWER
+	#define	MSF_LOWPOWER		(0)
+#endif
+
+/** Keep the crystal oscillator running in the stop modes.
+ 1 = the wake-up takes less than 1 ms (the oscillator does not need to start again; 
+ from the 48 MHz clock the PLL needs to lock, about 0.5 ms); the oscillator takes tens of uA (default).
+ 0 = lowest current; the oscillator starts again after the wake-up (several ms). 
+ The UART0 and the TPM timers in msf_power_low state keep the oscillator running anyway;
+ with 0 it stops again when none of them is in msf_power_low (see msf_lowpower_oscer).
+ */
+#ifndef MSF_LOWPOWER_FAST_WAKE
+	#define	MSF_LOWPOWER_FAST_WAKE	(1)
+#endif
 
 
 /*********************************************
@@ -109,9 +189,53 @@
  @note this is default value; any value can be set by driver Control function. 
  */
 #define	WMSF_ADC_AVERAGE		(0)
+
+/** Address of stored ADC calibration data (MSF_ADC_CALIB structure), e.g. in flash. 
+ If nonzero, the ADC driver restores the calibration from this address in Initialize
+ and performs the (slow) calibration only if the data are not valid. 
+ 0 = always calibrate the ADC in Initialize.
+ @note Define this in your msf_config.h to override the default. 
+ */
+#ifndef WMSF_ADC_CALIB_ADDRESS
+	#define	WMSF_ADC_CALIB_ADDRESS	(0)
+#endif
  
 /******************** End ADC driver options *************************/
 
+/******************** TPM driver options *************************/
+/** Support for streaming tables of values into the TPM channel registers by DMA 
+ (see ChannelStream in drv_tpm.h). 
+ 1 = enabled; the TPM driver uses one DMA channel for each TPM instance
+ and defines the interrupt handler(s) for these DMA channels.
+ 0 = disabled; the DMA is not used by the TPM driver.
+ @note Define this in your msf_config.h to override the default. 
+ */
+#ifndef MSF_TPM_DMA
+	#define	MSF_TPM_DMA		(0)
+#endif
+
+/** DMA channel (0 - 3) used by given TPM instance if MSF_TPM_DMA is enabled.
+ Each TPM must use different channel. */
+#ifndef WMSF_TPM0_DMA_CHANNEL
+	#define	WMSF_TPM0_DMA_CHANNEL	(0)
+#endif
+#ifndef WMSF_TPM1_DMA_CHANNEL
+	#define	WMSF_TPM1_DMA_CHANNEL	(1)
+#endif
+#ifndef WMSF_TPM2_DMA_CHANNEL
+	#define	WMSF_TPM2_DMA_CHANNEL	(2)
+#endif
+
+/** The input pin for the external clock of the TPM timers (MSF_TPM_CLOCK_EXTERNAL).
+ 0 = TPM_CLKIN0, 1 = TPM_CLKIN1. 
+ The pin for this input is configured by defining MSF_TPM_CLKIN_PIN and MSF_TPM_CLKIN_ALT
+ in your msf_config.h, e.g. GPIO_B16 and 4 for TPM_CLKIN0.
+ */
+#ifndef WMSF_TPM_CLKIN
+	#define	WMSF_TPM_CLKIN		(0)
+#endif
+/******************** End TPM driver options *************************/
+
 /* Check if there is valid F_CPU defined in msf-config.h */
 #if !( (F_CPU == 41943040) ||  (F_CPU == 48000000) || (F_CPU == 8000000) || (F_CPU == 20900000) || (F_CPU == 4000000)  || (F_CPU == 20970000))
 	#error Please define valid F_CPU in msf_config.h. It is possible that the clock speed is not supported.
@@ -0,0 +1,206 @@
+/****************************************************************************
+ * @file     defer.c
+ * @brief    Deferred interrupt work - handoff from ISR to main context
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	Ring buffer of work items with free-running 8-bit indexes; the consumer
+ * 			(defer_run) only advances the get index, the producers (defer_call) only
+ * 			the put index.
+ *
+ ******************************************************************************/
+
+/** @addtogroup group_defer
+ * @{
+ */
+
+/* Include section
+* Add all #includes here
+*
+***************************************************/
+/* Include user configuration */
+#include "msf_config.h"
+/* Include hardware definitions */
+#include "coredef.h"
+/* Include any standard headers, such as string.h */
+
+/* Include our main header*/
+#include "msf.h"
+/* Include the header for this module */
+#include "defer.h"
+
+
+/* Defines section
+* Add all internally used #defines here
+*
+***************************************************/
+#if (DEFER_QUEUE_SIZE & (DEFER_QUEUE_SIZE - 1)) != 0 || DEFER_QUEUE_SIZE > 128
+	#error "DEFER_QUEUE_SIZE must be power of 2, max 128"
+#endif
+
+#define		DEFER_QUEUE_MASK	(DEFER_QUEUE_SIZE - 1)
+
+/* One work item */
+typedef struct defer_item
+{
+	DEFER_Func_t	func;
+	uint32_t		arg;
+#if DEFER_MEASURE
+	uint32_t		time;		/* when it was queued */
+#endif
+} DEFER_ITEM;
+
+
+/* Variables section
+* Add all variables here
+*
+***************************************************/
+static volatile DEFER_ITEM gdefer_queue[DEFER_QUEUE_SIZE];
+static volatile uint8_t gdefer_put;		/* written only by defer_call */
+static volatile uint8_t gdefer_get;		/* written only by defer_run */
+static DEFER_STATS gdefer_stats;
+
+
+/* Function Prototype Section
+* Add prototypes for all functions called by this
+* module, with the exception of runtime routines.
+*
+***************************************************/
+
+
+/* Code section
+* Add the code for this module.
+*
+***************************************************/
+/* -------- Implementation of public functions   -------- */
+
+/*
+ * Initialize the queue
+ */
+void defer_init(void)
+{
+	gdefer_put = 0;
+	gdefer_get = 0;
+	defer_reset_stats();
+#if DEFER_USE_PENDSV
+	/* the lowest priority, so that the work runs after all other interrupts */
+	NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+#endif
+}
+
+/*
+ * Queue work to be executed later
+ */
+uint8_t defer_call(DEFER_Func_t func, uint32_t arg)
+{
+	uint32_t primask;
+	uint8_t put, depth;
+#if DEFER_MEASURE
+	uint32_t now = DEFER_TIMESTAMP();
+#endif
+
+	if ( func == null )
+		return MSF_ERROR_ARGUMENT;
+
+	/* Reserve and fill the slot; a higher-priority interrupt must not use the same slot.
+	 * The interrupt state of the caller is restored (MSF_ATOMIC_END would enable the interrupts) */
+	primask = __get_PRIMASK();
+	__disable_irq();
+	put = gdefer_put;
+	depth = (uint8_t)(put - gdefer_get);
+	if ( depth >= DEFER_QUEUE_SIZE )
+	{
+		gdefer_stats.overflows++;
+		__set_PRIMASK(primask);
+		return DEFER_ERROR_FULL;
+	}
+	gdefer_queue[put & DEFER_QUEUE_MASK].func = func;
+	gdefer_queue[put & DEFER_QUEUE_MASK].arg = arg;
+#if DEFER_MEASURE
+	gdefer_queue[put & DEFER_QUEUE_MASK].time = now;
+#endif
+	gdefer_put = put + 1;
+	gdefer_stats.queued++;
+	if ( depth + 1 > gdefer_stats.depth_max )
+		gdefer_stats.depth_max = depth + 1;
+	__set_PRIMASK(primask);
+
+#if DEFER_USE_PENDSV
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#endif
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Execute the queued work
+ */
+uint8_t defer_run(void)
+{
+	DEFER_Func_t func;
+	uint32_t arg;
+	uint8_t get, count = 0;
+#if DEFER_MEASURE
+	uint32_t latency;
+#endif
+
+	get = gdefer_get;
+	while ( get != gdefer_put )
+	{
+		func = gdefer_queue[get & DEFER_QUEUE_MASK].func;
+		arg = gdefer_queue[get & DEFER_QUEUE_MASK].arg;
+#if DEFER_MEASURE
+		latency = DEFER_TIMESTAMP() - gdefer_queue[get & DEFER_QUEUE_MASK].time;
+		gdefer_stats.latency_last = latency;
+		if ( latency > gdefer_stats.latency_max )
+			gdefer_stats.latency_max = latency;
+#endif
+		/* free the slot before calling the function, so that it can queue more work */
+		gdefer_get = ++get;
+		func(arg);
+		gdefer_stats.executed++;
+		count++;
+	}
+
+	return count;
+}
+
+/*
+ * Get the statistics of the queue
+ */
+void defer_get_stats(DEFER_STATS* stats)
+{
+	if ( stats == null )
+		return;
+	MSF_ATOMIC_BEGIN();
+	*stats = gdefer_stats;
+	stats->depth = (uint8_t)(gdefer_put - gdefer_get);
+	MSF_ATOMIC_END();
+}
+
+/*
+ * Reset the statistics
+ */
+void defer_reset_stats(void)
+{
+	MSF_ATOMIC_BEGIN();
+	gdefer_stats.queued = 0;
+	gdefer_stats.executed = 0;
+	gdefer_stats.overflows = 0;
+	gdefer_stats.latency_last = 0;
+	gdefer_stats.latency_max = 0;
+	gdefer_stats.depth = 0;
+	gdefer_stats.depth_max = 0;
+	MSF_ATOMIC_END();
+}
+
+/* -------- Implementation of internal functions   -------- */
+
+#if DEFER_USE_PENDSV
+/* The PendSV interrupt requested by defer_call */
+void PendSV_Handler(void)
+{
+	defer_run();
+}
+#endif
+
+/** @}*/
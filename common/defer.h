@@ -0,0 +1,146 @@
+/****************************************************************************
+ * @file     defer.h
+ * @brief    Deferred interrupt work - handoff from ISR to main context
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef MSF_DEFER_H
+    #define MSF_DEFER_H
+
+/** @defgroup group_defer defer - deferred interrupt work
+ * @{
+ * @brief Moves the work from interrupt handlers to the main loop or to the lowest interrupt priority.
+ * @details
+ * The driver callbacks (e.g. the UART or TPM events) run in the interrupt handler, so any
+ * longer work done in them delays all other interrupts of the same or lower priority.
+ * With this module the callback only puts a work item (a function and its argument) into
+ * a queue and returns. The items are executed later, in the order in which they were queued,
+ * by defer_run called from the main loop, or by the PendSV interrupt with the lowest priority
+ * (DEFER_USE_PENDSV), which runs when no other interrupt is active.<br>
+ * <br>
+ * <b>Howto use the deferred work</b><br>
+ * 1) Write the work function: void process_rx(uint32_t arg) { ... }<br>
+ * 2) In the interrupt handler or driver callback queue it: defer_call(process_rx, data);<br>
+ * 3) Call defer_run() in the main loop (not needed if DEFER_USE_PENDSV is 1).<br>
+ * <br>
+ * <b>Implementation notes</b><br>
+ * The queue is a ring buffer with one consumer (defer_run), which needs no lock. The Cortex-M0+
+ * does not have the exclusive access instructions (LDREX/STREX), so the producers, which can be
+ * interrupt handlers of different priorities preempting each other, reserve the slot with
+ * the interrupts disabled for a few instructions. The interrupt state of the caller is restored,
+ * so defer_call can be called also with the interrupts disabled.<br>
+ * The statistics (defer_get_stats) show the maximum depth of the queue, the number of
+ * items lost because the queue was full, and the latency - the time from defer_call to the start
+ * of the work function, measured by DEFER_TIMESTAMP().
+ *
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Defines section
+* Add all public #defines here
+*
+***************************************************/
+
+/** Number of work items the queue can hold; must be power of 2, max 128.
+ * You can define this in your msf_config.h */
+#ifndef DEFER_QUEUE_SIZE
+	#define	DEFER_QUEUE_SIZE	(16)
+#endif
+
+/** Run the queued work from the PendSV interrupt (1) or only from defer_run called
+ * by the program (0). The PendSV has the lowest priority, so the work runs after
+ * all other interrupts are handled. Defines the PendSV_Handler.
+ * You can define this in your msf_config.h */
+#ifndef DEFER_USE_PENDSV
+	#define	DEFER_USE_PENDSV	(0)
+#endif
+
+/** Measure the latency of the work items (1) or not (0).
+ * You can define this in your msf_config.h */
+#ifndef DEFER_MEASURE
+	#define	DEFER_MEASURE		(1)
+#endif
+
+/** The time source for measuring the latency; see msf_ticks32 */
+#ifndef DEFER_TIMESTAMP
+	#define	DEFER_TIMESTAMP()	msf_ticks32()
+#endif
+
+/** Error codes returned by defer functions */
+#define	DEFER_ERROR_FULL		(MSF_ERROR_LAST+1)	/**< the queue is full; the item was not queued */
+
+/** @brief The work function.
+ * @param arg the argument given to defer_call
+ */
+typedef void (*DEFER_Func_t)(uint32_t arg);
+
+/** @brief Statistics of the queue */
+typedef struct defer_stats
+{
+	uint32_t	queued;			/**< number of items queued */
+	uint32_t	executed;		/**< number of items executed */
+	uint32_t	overflows;		/**< number of items lost because the queue was full */
+	uint32_t	latency_last;	/**< time from queuing to execution of the last item */
+	uint32_t	latency_max;	/**< maximum time from queuing to execution */
+	uint8_t		depth;			/**< current number of items in the queue */
+	uint8_t		depth_max;		/**< maximum number of items in the queue */
+} DEFER_STATS;
+
+
+/* Function Prototype Section
+* Add prototypes for all public functions.
+* Write doxygen comments here!
+*
+***************************************************/
+
+/**
+ * @brief Initialize the queue.
+ * @note With DEFER_USE_PENDSV this sets the PendSV priority to the lowest.
+ */
+void defer_init(void);
+
+/**
+ * @brief Queue work to be executed later.
+ * @param func the function to call
+ * @param arg the argument for the function
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if func is null;
+ *  DEFER_ERROR_FULL if the queue is full (the item is lost and counted in the statistics).
+ * @note Can be called from any interrupt handler and from the main loop.
+ */
+uint8_t defer_call(DEFER_Func_t func, uint32_t arg);
+
+/**
+ * @brief Execute the queued work.
+ * @return the number of items executed
+ * @note Executes also the items queued while it runs. Must not be called from an
+ * interrupt handler. If DEFER_USE_PENDSV is 1, it is called by the PendSV handler and
+ * the program must not call it.
+ */
+uint8_t defer_run(void);
+
+/**
+ * @brief Get the statistics of the queue.
+ * @param stats pointer to the structure to fill
+ */
+void defer_get_stats(DEFER_STATS* stats);
+
+/**
+ * @brief Reset the statistics to zero.
+ */
+void defer_reset_stats(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+/* ----------- end of file -------------- */
+#endif /* MSF_DEFER_H */
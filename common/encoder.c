@@ -0,0 +1,413 @@
+/****************************************************************************
+ * @file     encoder.c
+ * @brief    Quadrature encoder decoder using TPM input capture
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	The edges are decoded by a table indexed by the previous and
+ * 			the current level of the signals, so the interrupt handler has
+ * 			no branches for the direction. Division is used only when the
+ * 			velocity is read.
+ *
+ ******************************************************************************/
+
+/** @addtogroup group_encoder
+ * @{
+ */
+
+/* Include section
+* Add all #includes here
+*
+***************************************************/
+#if ENCODER_HOST
+/* Build for PC - only the decoding and standard headers */
+#include <stdint.h>
+#include <stddef.h>
+#define		MSF_ERROR_OK		(0)
+#define		MSF_ERROR_ARGUMENT	(6)
+#define		MSF_ATOMIC_BEGIN()
+#define		MSF_ATOMIC_END()
+#else
+/* Include user configuration */
+#include "msf_config.h"
+/* Include hardware definitions */
+#include "coredef.h"
+/* Include any standard headers, such as string.h */
+
+/* Include our main header*/
+#include "msf.h"
+#endif
+/* Include the header for this module */
+#include "encoder.h"
+
+
+/* Defines section
+* Add all internally used #defines here
+*
+***************************************************/
+/* Number of TPM timers which can be used by the encoders */
+#define		ENCODER_MAX_DRIVERS		(3)
+
+/* Value in the decoding table for invalid transition */
+#define		ENCODER_INVALID			(2)
+
+
+/* Variables section
+* Add all variables here
+*
+***************************************************/
+/* The change of position for each transition; the index is the previous AB in bits 2-3
+ * and the current AB in bits 0-1. Forward sequence is 00 -> 10 -> 11 -> 01 -> 00. */
+static const int8_t gencoder_table[16] = {
+	0, -1, +1, ENCODER_INVALID,		/* from 00 */
+	+1, 0, ENCODER_INVALID, -1,		/* from 01 */
+	-1, ENCODER_INVALID, 0, +1,		/* from 10 */
+	ENCODER_INVALID, +1, -1, 0,		/* from 11 */
+};
+
+#if !ENCODER_HOST
+
+/* The encoder for each channel of each timer */
+static ENCODER* gencoder_channel[ENCODER_MAX_DRIVERS][6];
+
+/* Number of overflows of each timer; the upper 16 bits of the time stamps */
+static volatile uint32_t gencoder_overflows[ENCODER_MAX_DRIVERS];
+
+/* Number of encoders using each timer */
+static uint8_t gencoder_users[ENCODER_MAX_DRIVERS];
+
+/* Number of channels of each timer */
+static const uint8_t gencoder_nchannels[ENCODER_MAX_DRIVERS] = { 6, 2, 2 };
+
+
+/* Function Prototype Section
+* Add prototypes for all functions called by this
+* module, with the exception of runtime routines.
+*
+***************************************************/
+/* -------- Prototypes of internal functions   -------- */
+static void encoder_timer0_event(uint32_t event, uint32_t arg);
+static void encoder_timer1_event(uint32_t event, uint32_t arg);
+static void encoder_timer2_event(uint32_t event, uint32_t arg);
+static void encoder_timer0_channel(uint32_t channel, uint32_t value);
+static void encoder_timer1_channel(uint32_t channel, uint32_t value);
+static void encoder_timer2_channel(uint32_t channel, uint32_t value);
+static void encoder_on_capture(uint8_t tpm_index, uint8_t channel, uint16_t cntval);
+static uint32_t encoder_get_time(uint8_t tpm_index, uint16_t cntval);
+static uint32_t encoder_now(uint8_t tpm_index);
+static MSF_DRIVER_TPM* encoder_get_driver(uint8_t tpm_index);
+
+/* The event handlers for the timers */
+static const MSF_TPM_Event_t gencoder_events[ENCODER_MAX_DRIVERS] =
+	{ encoder_timer0_event, encoder_timer1_event, encoder_timer2_event };
+static const MSF_TPM_Channel_Event_t gencoder_channel_events[ENCODER_MAX_DRIVERS] =
+	{ encoder_timer0_channel, encoder_timer1_channel, encoder_timer2_channel };
+#endif	/* !ENCODER_HOST */
+
+
+/* Code section
+* Add the code for this module.
+*
+***************************************************/
+/* -------- Implementation of public functions   -------- */
+#if !ENCODER_HOST
+/*
+ * Start decoding the encoder
+ */
+uint8_t encoder_start(ENCODER* enc, MSF_DRIVER_TPM* tpm, uint8_t channel_a, uint8_t channel_b,
+		MCU_pin_t pin_a, MCU_pin_t pin_b, uint8_t window)
+{
+	uint8_t tpm_index, ab;
+
+	for ( tpm_index = 0; tpm_index < ENCODER_MAX_DRIVERS; tpm_index++ )
+	{
+		if ( tpm != null && encoder_get_driver(tpm_index) == tpm )
+			break;
+	}
+
+	if ( enc == null || tpm_index >= ENCODER_MAX_DRIVERS || channel_a == channel_b
+			|| channel_a >= gencoder_nchannels[tpm_index] || channel_b >= gencoder_nchannels[tpm_index]
+			|| gencoder_channel[tpm_index][channel_a] != null || gencoder_channel[tpm_index][channel_b] != null
+			|| window == 0 || window >= ENCODER_HISTORY )
+		return MSF_ERROR_ARGUMENT;
+
+	enc->tpm_index = tpm_index;
+	enc->channel_a = channel_a;
+	enc->channel_b = channel_b;
+	enc->pdir_a = &GPIO_DATAIN_REG(pin_a);
+	enc->pdir_b = &GPIO_DATAIN_REG(pin_b);
+	enc->mask_a = GPIO_PIN_MASK(pin_a);
+	enc->mask_b = GPIO_PIN_MASK(pin_b);
+
+	if ( gencoder_users[tpm_index]++ == 0 )
+	{
+		gencoder_overflows[tpm_index] = 0;
+		tpm->Initialize(gencoder_events[tpm_index]);
+		tpm->Control(MSF_TPM_PRESCALER_SET | MSF_TPM_TOF_SIGNAL, ENCODER_PRESCALER);
+	}
+
+	// connect the pins to the timer first, then read their level
+	gencoder_channel[tpm_index][channel_a] = enc;
+	gencoder_channel[tpm_index][channel_b] = enc;
+	tpm->ChannelSetHandler(channel_a, gencoder_channel_events[tpm_index]);
+	tpm->ChannelSetHandler(channel_b, gencoder_channel_events[tpm_index]);
+	tpm->ChannelSetMode(channel_a, InCapture_both_edges, 0);
+	tpm->ChannelSetMode(channel_b, InCapture_both_edges, 0);
+
+	ab = ((*enc->pdir_a & enc->mask_a) ? 2 : 0) | ((*enc->pdir_b & enc->mask_b) ? 1 : 0);
+	encoder_init(enc, window, WMSF_TPM_CLOCK >> ENCODER_PRESCALER, ab);
+
+	tpm->ChannelSetMode(channel_a, InCapture_both_edges, MSF_TPM_PARAM_CHANNEL_EVENT);
+	tpm->ChannelSetMode(channel_b, InCapture_both_edges, MSF_TPM_PARAM_CHANNEL_EVENT);
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Stop decoding the encoder
+ */
+void encoder_stop(ENCODER* enc)
+{
+	MSF_DRIVER_TPM* tpm = encoder_get_driver(enc->tpm_index);
+
+	if ( tpm == null || gencoder_channel[enc->tpm_index][enc->channel_a] != enc )
+		return;
+
+	tpm->ChannelSetMode(enc->channel_a, Disabled, 0);
+	tpm->ChannelSetMode(enc->channel_b, Disabled, 0);
+	tpm->ChannelSetHandler(enc->channel_a, null);
+	tpm->ChannelSetHandler(enc->channel_b, null);
+	gencoder_channel[enc->tpm_index][enc->channel_a] = null;
+	gencoder_channel[enc->tpm_index][enc->channel_b] = null;
+
+	if ( --gencoder_users[enc->tpm_index] == 0 )
+		tpm->Uninitialize();
+}
+
+/*
+ * Get the velocity
+ */
+int32_t encoder_velocity(ENCODER* enc)
+{
+	return encoder_velocity_at(enc, encoder_now(enc->tpm_index));
+}
+#endif	/* !ENCODER_HOST */
+
+/*
+ * Get the position
+ */
+int32_t encoder_position(ENCODER* enc)
+{
+	return enc->position;
+}
+
+/*
+ * Set the position
+ */
+void encoder_set_position(ENCODER* enc, int32_t position)
+{
+	enc->position = position;
+}
+
+/*
+ * Get the number of invalid transitions
+ */
+uint32_t encoder_errors(ENCODER* enc)
+{
+	return enc->errors;
+}
+
+/*
+ * Initialize the encoder state
+ */
+uint8_t encoder_init(ENCODER* enc, uint8_t window, uint32_t tick_rate, uint8_t ab)
+{
+	if ( window == 0 || window >= ENCODER_HISTORY )
+		return MSF_ERROR_ARGUMENT;
+
+	enc->position = 0;
+	enc->errors = 0;
+	enc->tick_rate = tick_rate;
+	enc->head = 0;
+	enc->fill = 0;
+	enc->window = window;
+	enc->state = ab & 0x03;
+	enc->dir = 0;
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Process an edge
+ */
+void encoder_edge(ENCODER* enc, uint8_t ab, uint32_t time)
+{
+	int8_t delta;
+
+	enc->state = ((enc->state << 2) | (ab & 0x03)) & 0x0f;
+	delta = gencoder_table[enc->state];
+	if ( delta == 0 )
+		return;		// no change (e.g. glitch shorter than the interrupt latency)
+
+	if ( delta == ENCODER_INVALID )
+	{
+		enc->errors++;
+		return;
+	}
+
+	enc->position += delta;
+
+	// The velocity is averaged only over the edges in the same direction
+	if ( delta != enc->dir )
+	{
+		enc->dir = delta;
+		enc->fill = 0;
+	}
+	enc->times[enc->head] = time;
+	enc->head = (enc->head + 1) & (ENCODER_HISTORY - 1);
+	if ( enc->fill <= enc->window )
+		enc->fill++;
+}
+
+/*
+ * Get the velocity at given time
+ */
+int32_t encoder_velocity_at(ENCODER* enc, uint32_t now)
+{
+	uint32_t first, last, span, late, avg;
+	uint8_t n;
+	int8_t dir;
+
+	// take consistent snapshot of the data updated by the ISR
+	MSF_ATOMIC_BEGIN();
+	n = (enc->fill > 1) ? enc->fill - 1 : 0;
+	last = enc->times[(enc->head - 1) & (ENCODER_HISTORY - 1)];
+	first = enc->times[(enc->head - 1 - n) & (ENCODER_HISTORY - 1)];
+	dir = enc->dir;
+	MSF_ATOMIC_END();
+
+	if ( n == 0 )
+		return 0;
+
+	// If the next edge is late, assume it occurs now, so the velocity decreases
+	// continuously when the encoder stops.
+	span = last - first;
+	avg = span / n;
+	late = now - last;
+	if ( late > avg )
+		span += late - avg;
+	if ( span == 0 )
+		return 0;
+
+	return dir * (int32_t)((n * enc->tick_rate) / span);
+}
+
+/* -------- Implementation of internal functions   -------- */
+#if !ENCODER_HOST
+
+/* Get the TPM driver for given index; null if the driver is not enabled */
+static MSF_DRIVER_TPM* encoder_get_driver(uint8_t tpm_index)
+{
+	switch ( tpm_index )
+	{
+#if (MSF_DRIVER_TPM0)
+	case 0:
+		return &Driver_TPM0;
+#endif
+#if (MSF_DRIVER_TPM1)
+	case 1:
+		return &Driver_TPM1;
+#endif
+#if (MSF_DRIVER_TPM2)
+	case 2:
+		return &Driver_TPM2;
+#endif
+	default:
+		return null;
+	}
+}
+
+/* Process the capture event of a channel
+ * param tpm_index index of the timer
+ * param channel the timer channel
+ * param cntval the captured value (CnV) */
+static void encoder_on_capture(uint8_t tpm_index, uint8_t channel, uint16_t cntval)
+{
+	ENCODER* enc = gencoder_channel[tpm_index][channel];
+	uint8_t ab = enc->state & 0x03;
+
+	// Only the signal of this channel changed; the other one is updated by its own event,
+	// so two edges close to each other are both counted.
+	if ( channel == enc->channel_a )
+		ab = (ab & 0x01) | ((*enc->pdir_a & enc->mask_a) ? 2 : 0);
+	else
+		ab = (ab & 0x02) | ((*enc->pdir_b & enc->mask_b) ? 1 : 0);
+
+	encoder_edge(enc, ab, encoder_get_time(tpm_index, cntval));
+}
+
+/* Get the 32-bit time stamp for the value captured by given timer.
+ * Must be called from the TPM event handler (the overflow count cannot change). */
+static uint32_t encoder_get_time(uint8_t tpm_index, uint16_t cntval)
+{
+	uint32_t cnt, ovf;
+
+	cnt = encoder_get_driver(tpm_index)->CounterRead();
+	ovf = gencoder_overflows[tpm_index] + (cnt >> 16);	// MSF_TPM_COUNTER_TOF is bit 16
+	// If the captured value is higher than the counter now, the counter overflowed after
+	// the capture, so the edge belongs to the period before the last overflow.
+	if ( cntval > (cnt & 0xffff) )
+		ovf--;
+
+	return (ovf << 16) + cntval;
+}
+
+/* Get the current time of given timer */
+static uint32_t encoder_now(uint8_t tpm_index)
+{
+	uint32_t cnt, ovf;
+
+	MSF_ATOMIC_BEGIN();
+	cnt = encoder_get_driver(tpm_index)->CounterRead();
+	ovf = gencoder_overflows[tpm_index] + (cnt >> 16);
+	MSF_ATOMIC_END();
+
+	return (ovf << 16) + (cnt & 0xffff);
+}
+
+/* Event handlers of the timers; only TOF comes here, the channels have direct handlers */
+static void encoder_timer0_event(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_TPM_EVENT_TOF )
+		gencoder_overflows[0]++;
+}
+
+static void encoder_timer1_event(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_TPM_EVENT_TOF )
+		gencoder_overflows[1]++;
+}
+
+static void encoder_timer2_event(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_TPM_EVENT_TOF )
+		gencoder_overflows[2]++;
+}
+
+/* Channel handlers of the timers */
+static void encoder_timer0_channel(uint32_t channel, uint32_t value)
+{
+	encoder_on_capture(0, (uint8_t)channel, (uint16_t)value);
+}
+
+static void encoder_timer1_channel(uint32_t channel, uint32_t value)
+{
+	encoder_on_capture(1, (uint8_t)channel, (uint16_t)value);
+}
+
+static void encoder_timer2_channel(uint32_t channel, uint32_t value)
+{
+	encoder_on_capture(2, (uint8_t)channel, (uint16_t)value);
+}
+#endif	/* !ENCODER_HOST */
+
+/** @}*/
@@ -0,0 +1,196 @@
+/****************************************************************************
+ * @file     encoder.h
+ * @brief    Quadrature encoder decoder using TPM input capture
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef MSF_ENCODER_H
+    #define MSF_ENCODER_H
+
+/** @defgroup group_encoder encoder - quadrature encoder decoder
+ * @{
+ * @brief Position and velocity from incremental (quadrature) encoder.
+ * @details
+ * The signals A and B of the encoder are connected to two channels of a timer (TPMn)
+ * in input capture mode, so each edge is time-stamped by the hardware and
+ * decoded in the timer interrupt. All 4 edges of each cycle are counted
+ * (x4 decoding). The position is 32-bit signed number; it increases when A leads B.<br>
+ * The velocity is computed from the time stamps of the last N edges (averaging window),
+ * which gives good resolution also at low speed, where only few edges are counted per second.<br>
+ * <br>
+ * <b>Howto use the encoder</b><br>
+ * 1) Declare the state variable, e.g. ENCODER myenc;<br>
+ * 2) Start it: encoder_start(&myenc, &Driver_TPM1, 0, 1, GPIO_A12, GPIO_A13, 4);<br>
+ * The pins must be the pins of the timer channels, see MSF_TPMn_CHm_PIN in msf_config_mkl25z.h.<br>
+ * 3) Read the position and velocity: encoder_position(&myenc); encoder_velocity(&myenc);<br>
+ * <br>
+ * The decoding itself (encoder_init, encoder_edge, encoder_velocity_at) does not access the hardware,
+ * so it can be also used with other source of the edges or tested with synthetic edges
+ * on a PC. If compiled with ENCODER_HOST defined as 1 (e.g. -DENCODER_HOST=1), encoder.c
+ * contains only the decoding and needs only standard C headers; the test is in
+ * test/host/encoder_test.c.<br>
+ * <br>
+ * <b>Limits</b><br>
+ * The interrupt handler uses only a table look-up and additions (no division), so one edge takes
+ * in the order of 1 - 2 us at 48 MHz CPU clock including the TPM driver. This allows edge rates
+ * of several tens of kHz; e.g. 10 kHz signal on A and B gives 40 000 edges per second.
+ * Two edges closer than the interrupt latency may be counted in wrong order, which
+ * is reported by encoder_errors.
+ *
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if ENCODER_HOST
+#include <stdint.h>
+#else
+#include "drv_tpm.h"
+#endif
+
+/* Defines section
+* Add all public #defines here
+*
+***************************************************/
+
+/** Number of time stamps kept by each encoder; the averaging window can be 1 thru
+ * ENCODER_HISTORY - 1 edges. Must be power of 2. */
+#define		ENCODER_HISTORY			(16)
+
+/** Prescaler for the timer used by the encoder; determines the resolution of the time stamps.
+ * The default (8) gives 1 MHz for the TPM clock 8 MHz (F_CPU 48 MHz).
+ * You can define this in your msf_config.h */
+#ifndef ENCODER_PRESCALER
+	#define	ENCODER_PRESCALER		(MSF_TPM_PRESCALER_8)
+#endif
+
+/** @brief State of the encoder.
+ * @note Do not access the members directly; use the encoder_ functions.
+ */
+typedef struct encoder
+{
+	volatile int32_t	position;	/* the position in edges */
+	volatile uint32_t	errors;		/* number of invalid transitions (both signals changed) */
+	uint32_t	times[ENCODER_HISTORY];	/* time stamps of the last edges (ring buffer) */
+	uint32_t	tick_rate;	/* frequency of the time stamps in Hz */
+	uint8_t		head;		/* where the next time stamp is written */
+	uint8_t		fill;		/* number of valid time stamps in the same direction */
+	uint8_t		window;		/* averaging window in edges */
+	uint8_t		state;		/* the previous and current level of A and B */
+	int8_t		dir;		/* direction of the last edge; +1 or -1 */
+	/* the hardware */
+	uint8_t		tpm_index;
+	uint8_t		channel_a;
+	uint8_t		channel_b;
+	volatile const uint32_t*	pdir_a;	/* input data register of the pin A */
+	volatile const uint32_t*	pdir_b;
+	uint32_t	mask_a;		/* the pin A in the data register */
+	uint32_t	mask_b;
+} ENCODER;
+
+
+/* Function Prototype Section
+* Add prototypes for all public functions.
+* Write doxygen comments here!
+*
+***************************************************/
+#if !ENCODER_HOST
+/**
+ * @brief Start decoding the encoder connected to given timer channels.
+ * @param enc pointer to the encoder state; must exist as long as the encoder is used.
+ * @param tpm the timer, e.g. &Driver_TPM1. The timer is initialized by this function; it can be
+ *  shared by several encoders, but not used by other modules (e.g. waveio) at the same time.
+ * @param channel_a the timer channel for the signal A
+ * @param channel_b the timer channel for the signal B
+ * @param pin_a the pin of channel_a, e.g. GPIO_A12
+ * @param pin_b the pin of channel_b
+ * @param window averaging window for the velocity in edges; 1 thru ENCODER_HISTORY - 1.
+ *  Longer window gives smoother but delayed velocity.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the parameters are not valid.
+ */
+uint8_t encoder_start(ENCODER* enc, MSF_DRIVER_TPM* tpm, uint8_t channel_a, uint8_t channel_b,
+		MCU_pin_t pin_a, MCU_pin_t pin_b, uint8_t window);
+
+/**
+ * @brief Stop decoding the encoder.
+ * @param enc pointer to the encoder state
+ * @note The timer is uninitialized if no other encoder uses it.
+ */
+void encoder_stop(ENCODER* enc);
+
+/**
+ * @brief Get the current velocity.
+ * @param enc pointer to the encoder state
+ * @return the velocity in edges per second; negative if the position decreases.
+ *  0 if the encoder does not move.
+ */
+int32_t encoder_velocity(ENCODER* enc);
+#endif	/* !ENCODER_HOST */
+
+/**
+ * @brief Get the current position.
+ * @param enc pointer to the encoder state
+ * @return the position in edges (4 per cycle of the signals)
+ */
+int32_t encoder_position(ENCODER* enc);
+
+/**
+ * @brief Set the current position.
+ * @param enc pointer to the encoder state
+ * @param position the new position, e.g. 0 at the home switch
+ */
+void encoder_set_position(ENCODER* enc, int32_t position);
+
+/**
+ * @brief Get the number of invalid transitions detected (both signals changed at once).
+ * @param enc pointer to the encoder state
+ * @return the number of errors; non-zero value means the edges are too fast or there is noise.
+ */
+uint32_t encoder_errors(ENCODER* enc);
+
+/* -------- Decoding without hardware access   -------- */
+
+/**
+ * @brief Initialize the encoder state.
+ * @param enc pointer to the encoder state
+ * @param window averaging window for the velocity in edges; 1 thru ENCODER_HISTORY - 1.
+ * @param tick_rate frequency of the time stamps in Hz
+ * @param ab the current level of the signals; A in bit 1 and B in bit 0.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the window is not valid.
+ * @note Called by encoder_start; call it directly only if you provide the edges by encoder_edge.
+ */
+uint8_t encoder_init(ENCODER* enc, uint8_t window, uint32_t tick_rate, uint8_t ab);
+
+/**
+ * @brief Process an edge of the signals.
+ * @param enc pointer to the encoder state
+ * @param ab the level of the signals after the edge; A in bit 1 and B in bit 0.
+ * @param time the time stamp of the edge in ticks (see tick_rate in encoder_init)
+ * @note Called from the timer interrupt by the encoder; call it directly only if you
+ * provide the edges from other source.
+ */
+void encoder_edge(ENCODER* enc, uint8_t ab, uint32_t time);
+
+/**
+ * @brief Get the velocity at given time.
+ * @param enc pointer to the encoder state
+ * @param now the current time in ticks
+ * @return the velocity in edges per second
+ * @note If no edge occurs for longer than the average interval between edges,
+ * the velocity decreases as if the next edge occurred now, so it goes to 0 when
+ * the encoder stops.
+ */
+int32_t encoder_velocity_at(ENCODER* enc, uint32_t now);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+/* ----------- end of file -------------- */
+#endif /* MSF_ENCODER_H */
@@ -0,0 +1,309 @@
+/****************************************************************************
+ * @file     filter.c
+ * @brief    Fixed-point digital filters for blocks of ADC samples
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	Only integer addition, subtraction and shifts are used in the
+ * 			filters, so the code is fast also on Cortex-M0+ which has no
+ * 			hardware divide and no FPU.
+ *
+ ******************************************************************************/
+
+/** @addtogroup group_filter
+ * @{
+ */
+
+/* Include section
+* Add all #includes here
+*
+***************************************************/
+#if FILTER_HOST
+/* Build for PC - only standard headers */
+#include <stdint.h>
+#include <stddef.h>
+#define		null				NULL
+#define		MSF_ERROR_OK		(0)
+#define		MSF_ERROR_ARGUMENT	(6)
+#else
+/* Include user configuration */
+#include "msf_config.h"
+/* Include hardware definitions */
+#include "coredef.h"
+/* Include any standard headers, such as string.h */
+
+/* Include our main header*/
+#include "msf.h"
+#endif
+/* Include the header for this module */
+#include "filter.h"
+
+
+/* Defines section
+* Add all internally used #defines here
+*
+***************************************************/
+/* Largest supported window of the moving average (2^16 samples);
+ * the sum of 2^16 16-bit samples still fits into 32 bits. */
+#define		FILTER_MA_MAX_SHIFT		(16)
+
+/* Largest IIR coefficient shift; the accumulator (y * 2^shift) must fit into 32 bits. */
+#define		FILTER_IIR_MAX_SHIFT	(15)
+
+/* Largest total gain of the CIC filter (order * rshift) so that the registers
+ * do not overflow for 16-bit input. */
+#define		FILTER_CIC_MAX_GAIN_BITS	(16)
+
+
+/* Function Prototype Section
+* Add prototypes for all functions called by this
+* module, with the exception of runtime routines.
+*
+***************************************************/
+/* -------- Prototypes of internal functions   -------- */
+static uint16_t filter_median_select(const uint16_t* window, uint8_t n);
+
+
+/* Code section
+* Add the code for this module.
+*
+***************************************************/
+/* -------- Implementation of public functions   -------- */
+
+/*
+ * Initialize moving average filter
+ */
+uint8_t filter_ma_init(FILTER_MA* f, uint16_t* history, uint8_t shift, uint16_t initial)
+{
+	uint32_t i;
+
+	if ( shift > FILTER_MA_MAX_SHIFT || history == null )
+		return MSF_ERROR_ARGUMENT;
+
+	f->history = history;
+	f->shift = shift;
+	f->index = 0;
+	for ( i=0; i < (1UL << shift); i++ )
+		history[i] = initial;
+	f->sum = (uint32_t)initial << shift;
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Moving average of 2^shift samples.
+ * The sum is updated with the new sample and the oldest sample is removed,
+ * so the cost does not depend on the window size.
+ */
+void filter_ma_process(FILTER_MA* f, uint16_t* buf, uint32_t count)
+{
+	uint32_t sum = f->sum;
+	uint32_t index = f->index;
+	uint32_t mask = (1UL << f->shift) - 1;
+	uint8_t shift = f->shift;
+	uint16_t* history = f->history;
+
+	while ( count-- )
+	{
+		sum -= history[index];
+		sum += *buf;
+		history[index] = *buf;
+		index = (index + 1) & mask;
+		*buf++ = (uint16_t)(sum >> shift);
+	}
+
+	f->sum = sum;
+	f->index = (uint16_t)index;
+}
+
+/*
+ * Initialize the IIR filter
+ */
+uint8_t filter_iir_init(FILTER_IIR* f, uint8_t shift, uint16_t initial)
+{
+	if ( shift > FILTER_IIR_MAX_SHIFT )
+		return MSF_ERROR_ARGUMENT;
+
+	f->shift = shift;
+	f->acc = (uint32_t)initial << shift;
+	return MSF_ERROR_OK;
+}
+
+/*
+ * First order IIR filter y[n] = y[n-1] + (x[n] - y[n-1]) / 2^shift
+ * The accumulator holds y * 2^shift, so the update is:
+ *  acc = acc - acc/2^shift + x
+ * which never becomes negative and needs no multiplication.
+ */
+void filter_iir_process(FILTER_IIR* f, uint16_t* buf, uint32_t count)
+{
+	uint32_t acc = f->acc;
+	uint8_t shift = f->shift;
+	uint32_t round = (shift > 0) ? (1UL << (shift - 1)) : 0;
+
+	while ( count-- )
+	{
+		acc = acc - (acc >> shift) + *buf;
+		*buf++ = (uint16_t)((acc + round) >> shift);
+	}
+
+	f->acc = acc;
+}
+
+/*
+ * Initialize the median filter
+ */
+uint8_t filter_median_init(FILTER_MEDIAN* f, uint8_t n, uint16_t initial)
+{
+	uint8_t i;
+
+	if ( n < 3 || n > FILTER_MEDIAN_MAX || (n & 1) == 0 )
+		return MSF_ERROR_ARGUMENT;
+
+	f->n = n;
+	f->index = 0;
+	for ( i=0; i<n; i++ )
+		f->window[i] = initial;
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Median of the last n samples
+ */
+void filter_median_process(FILTER_MEDIAN* f, uint16_t* buf, uint32_t count)
+{
+	uint8_t index = f->index;
+	uint8_t n = f->n;
+
+	while ( count-- )
+	{
+		f->window[index] = *buf;
+		if ( ++index >= n )
+			index = 0;
+		*buf++ = filter_median_select(f->window, n);
+	}
+
+	f->index = index;
+}
+
+/*
+ * Initialize the CIC decimator
+ */
+uint8_t filter_cic_init(FILTER_CIC* f, uint8_t order, uint8_t rshift)
+{
+	uint8_t i;
+
+	if ( order < 1 || order > FILTER_CIC_MAX_ORDER )
+		return MSF_ERROR_ARGUMENT;
+	if ( rshift == 0 || (order * rshift) > FILTER_CIC_MAX_GAIN_BITS )
+		return MSF_ERROR_ARGUMENT;
+
+	f->order = order;
+	f->rshift = rshift;
+	f->phase = 0;
+	for ( i=0; i<FILTER_CIC_MAX_ORDER; i++ )
+	{
+		f->integrator[i] = 0;
+		f->comb[i] = 0;
+	}
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * CIC decimator with differential delay 1.
+ * The integrators run at the input rate and the combs at the output rate.
+ * The registers are allowed to wrap around - the arithmetic is modulo 2^32
+ * and the result is still correct as long as the real output value fits into 32 bits,
+ * which is guaranteed by the limit order * rshift <= 16.
+ * The output is written to buf[0], buf[1], ... which is never ahead of the input
+ * position, so the processing can be done in place.
+ */
+uint32_t filter_cic_process(FILTER_CIC* f, uint16_t* buf, uint32_t count)
+{
+	uint32_t i, out_cnt;
+	uint32_t value, tmp;
+	uint8_t stage;
+	uint8_t order = f->order;
+	uint32_t ratio_mask = (1UL << f->rshift) - 1;
+	uint8_t gain_shift = (uint8_t)(order * f->rshift);
+
+	out_cnt = 0;
+	for ( i=0; i<count; i++ )
+	{
+		/* integrators */
+		value = buf[i];
+		for ( stage = 0; stage < order; stage++ )
+		{
+			f->integrator[stage] += value;
+			value = f->integrator[stage];
+		}
+
+		f->phase = (uint16_t)((f->phase + 1) & ratio_mask);
+		if ( f->phase != 0 )
+			continue;
+
+		/* combs - only for every R-th input sample */
+		for ( stage = 0; stage < order; stage++ )
+		{
+			tmp = value;
+			value = value - f->comb[stage];
+			f->comb[stage] = tmp;
+		}
+
+		buf[out_cnt++] = (uint16_t)(value >> gain_shift);
+	}
+
+	return out_cnt;
+}
+
+
+/*
+ * --------------------------------------------
+ * Internal functions
+ * --------------------------------------------
+ */
+
+/* Return the median value of n samples in window.
+ * For the most common case (n = 3) we use simple comparisons;
+ * for the others the samples are copied and sorted by insertion sort. */
+static uint16_t filter_median_select(const uint16_t* window, uint8_t n)
+{
+	uint16_t sorted[FILTER_MEDIAN_MAX];
+	uint16_t a, b, c, tmp;
+	uint8_t i, j;
+
+	if ( n == 3 )
+	{
+		a = window[0];
+		b = window[1];
+		c = window[2];
+		if ( a > b )
+		{
+			tmp = a; a = b; b = tmp;
+		}
+		/* now a <= b */
+		if ( c >= b )
+			return b;
+		if ( c <= a )
+			return a;
+		return c;
+	}
+
+	for ( i=0; i<n; i++ )
+	{
+		tmp = window[i];
+		j = i;
+		while ( j > 0 && sorted[j-1] > tmp )
+		{
+			sorted[j] = sorted[j-1];
+			j--;
+		}
+		sorted[j] = tmp;
+	}
+
+	return sorted[n / 2];
+}
+
+/** @}*/
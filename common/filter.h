@@ -0,0 +1,210 @@
+/****************************************************************************
+ * @file     filter.h
+ * @brief    Fixed-point digital filters for blocks of ADC samples
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef MSF_FILTER_H
+    #define MSF_FILTER_H
+
+/** @defgroup group_filter filter - fixed-point digital filters
+ * @{
+ * @brief Simple digital filters for the samples obtained from the ADC.
+ * @details
+ * The filters work with integer arithmetic only, so they are suitable for
+ * MCUs without FPU, such as the Kinetis KL25Z.
+ * Each filter processes a block of samples "in place", that is, the filtered
+ * values are written back into the buffer with the input samples.
+ * The buffer is an array of uint16_t values as obtained from the ADC driver
+ * (Driver_ADC0.Read) or from msf_analog_read.<br>
+ * The state of the filter is kept in a structure provided by the caller, so
+ * any number of filters can be used at the same time, e.g. one for each
+ * analog input. The state is preserved between calls, so a continuous stream of
+ * samples can be processed in blocks of any size.<br>
+ * <br>
+ * <b>Available filters</b><br>
+ * Moving average - average of the last 2^N samples.<br>
+ * First order IIR (exponential averaging) - y = y + (x - y) / 2^K.<br>
+ * Median of N - removes spikes (single wrong samples) from the signal.<br>
+ * CIC decimator - averaging with decimation; the output has less samples than the input.<br>
+ * <br>
+ * <b>Howto use the filters</b><br>
+ * 1) Declare the state variable, e.g. FILTER_IIR myfilter;<br>
+ * 2) Initialize it: filter_iir_init(&myfilter, 4, 0);<br>
+ * 3) Fill a buffer with samples and process it: filter_iir_process(&myfilter, buffer, count);<br>
+ * <br>
+ * <b>Execution time</b><br>
+ * All the filters avoid division and multiplication (except the median, which
+ * uses only comparisons), so the cost per sample is low; for the moving average
+ * and IIR it is in the order of 10 - 20 CPU cycles per sample.
+ * The median cost grows with N (insertion sort of N values per sample).<br>
+ * <br>
+ * <b>Host build</b><br>
+ * The filters do not access the hardware. If compiled with FILTER_HOST defined as 1
+ * (e.g. -DFILTER_HOST=1), filter.c needs only standard C headers, so it can be built
+ * on a PC. The tests against double-precision reference and the benchmark are in
+ * test/host (filter_test.c, filter_bench.c).
+ *
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Defines section
+* Add all public #defines here
+*
+***************************************************/
+
+/** Maximum window size (N) for the median filter. Must be odd number. */
+#define		FILTER_MEDIAN_MAX		(9)
+
+/** Maximum order of the CIC filter (number of integrator and comb stages) */
+#define		FILTER_CIC_MAX_ORDER	(3)
+
+
+/** @brief State of the moving average filter.
+ * @note Do not access the members directly; use the filter_ma_ functions.
+ */
+typedef struct filter_ma
+{
+	uint16_t*	history;	/* user-provided buffer with the last 2^shift samples */
+	uint32_t	sum;		/* sum of the samples in history */
+	uint16_t	index;		/* position of the oldest sample in history */
+	uint8_t		shift;		/* window size is 2^shift */
+} FILTER_MA;
+
+/** @brief State of the first-order IIR filter.
+ * @note Do not access the members directly; use the filter_iir_ functions.
+ */
+typedef struct filter_iir
+{
+	uint32_t	acc;		/* output value multiplied by 2^shift */
+	uint8_t		shift;		/* filter coefficient; alpha = 1/2^shift */
+} FILTER_IIR;
+
+/** @brief State of the median filter.
+ * @note Do not access the members directly; use the filter_median_ functions.
+ */
+typedef struct filter_median
+{
+	uint16_t	window[FILTER_MEDIAN_MAX];	/* the last N samples (ring buffer) */
+	uint8_t		n;			/* size of the window */
+	uint8_t		index;		/* position of the oldest sample in window */
+} FILTER_MEDIAN;
+
+/** @brief State of the CIC decimator.
+ * @note Do not access the members directly; use the filter_cic_ functions.
+ */
+typedef struct filter_cic
+{
+	uint32_t	integrator[FILTER_CIC_MAX_ORDER];	/* integrator stages */
+	uint32_t	comb[FILTER_CIC_MAX_ORDER];		/* previous input of each comb stage */
+	uint16_t	phase;		/* number of inputs since the last output */
+	uint8_t		order;		/* number of stages (M) */
+	uint8_t		rshift;		/* decimation ratio R is 2^rshift */
+} FILTER_CIC;
+
+
+/* Function Prototype Section
+* Add prototypes for all public functions.
+* Write doxygen comments here!
+*
+***************************************************/
+
+/**
+ * @brief Initialize the moving average filter.
+ * @param f pointer to the filter state
+ * @param history buffer provided by the caller for the last samples.
+ *  It must have (1 << shift) elements and must exist as long as the filter is used.
+ * @param shift the window size as power of 2; 0 thru 16. For example, 3 means
+ *  average of 8 samples.
+ * @param initial the value the filter starts from (e.g. the first sample or 0).
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the shift is too big.
+ */
+uint8_t filter_ma_init(FILTER_MA* f, uint16_t* history, uint8_t shift, uint16_t initial);
+
+/**
+ * @brief Filter block of samples with the moving average filter.
+ * @param f pointer to the filter state
+ * @param buf the samples; they are replaced with the filtered values.
+ * @param count number of samples in buf.
+ * @note The result is truncated (not rounded) average.
+ */
+void filter_ma_process(FILTER_MA* f, uint16_t* buf, uint32_t count);
+
+/**
+ * @brief Initialize the first-order IIR (exponential) filter.
+ * @param f pointer to the filter state
+ * @param shift the filter coefficient; the filter computes
+ *  y = y + (x - y) / 2^shift. Valid values are 0 thru 15. Higher value means
+ *  stronger filtering (slower response). The time constant is about 2^shift samples.
+ * @param initial the value the filter starts from.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the shift is too big.
+ */
+uint8_t filter_iir_init(FILTER_IIR* f, uint8_t shift, uint16_t initial);
+
+/**
+ * @brief Filter block of samples with the IIR filter.
+ * @param f pointer to the filter state
+ * @param buf the samples; they are replaced with the filtered values.
+ * @param count number of samples in buf.
+ * @note The output is rounded to nearest integer.
+ */
+void filter_iir_process(FILTER_IIR* f, uint16_t* buf, uint32_t count);
+
+/**
+ * @brief Initialize the median filter.
+ * @param f pointer to the filter state
+ * @param n the number of samples from which the median is selected; odd number
+ *  3 thru FILTER_MEDIAN_MAX.
+ * @param initial the value the filter starts from.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if n is not valid.
+ */
+uint8_t filter_median_init(FILTER_MEDIAN* f, uint8_t n, uint16_t initial);
+
+/**
+ * @brief Filter block of samples with the median filter.
+ * @param f pointer to the filter state
+ * @param buf the samples; they are replaced with the filtered values.
+ * @param count number of samples in buf.
+ * @note Each output is the median of the current and the n-1 previous samples.
+ */
+void filter_median_process(FILTER_MEDIAN* f, uint16_t* buf, uint32_t count);
+
+/**
+ * @brief Initialize the CIC decimator.
+ * @param f pointer to the filter state
+ * @param order number of the integrator and comb stages; 1 thru FILTER_CIC_MAX_ORDER.
+ *  Order 1 is simple average of R samples.
+ * @param rshift decimation ratio R as power of 2; R = 2^rshift.
+ *  order * rshift must not be more than 16 (the registers are 32-bit and the samples 16-bit).
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the parameters are not valid.
+ */
+uint8_t filter_cic_init(FILTER_CIC* f, uint8_t order, uint8_t rshift);
+
+/**
+ * @brief Filter and decimate block of samples with the CIC filter.
+ * @param f pointer to the filter state
+ * @param buf the samples; the output samples are written to the beginning of
+ *  this buffer.
+ * @param count number of samples in buf.
+ * @return the number of output samples written to buf. This is about count / R;
+ *  the remaining input samples are kept in the filter state and used in next call.
+ * @note The output is scaled to the same range as the input (the gain R^order
+ *  of the filter is removed).
+ */
+uint32_t filter_cic_process(FILTER_CIC* f, uint16_t* buf, uint32_t count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+/* ----------- end of file -------------- */
+#endif /* MSF_FILTER_H */
@@ -0,0 +1,224 @@
+/****************************************************************************
+ * @file     freqcnt.c
+ * @brief    Frequency counter for high-frequency inputs
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	The edges are counted by a timer clocked from its external clock input;
+ * 			the counter is extended to 32 bits by counting its overflows and read
+ * 			at the end of each gate period.
+ *
+ ******************************************************************************/
+
+/** @addtogroup group_freqcnt
+ * @{
+ */
+
+/* Include section
+* Add all #includes here
+*
+***************************************************/
+/* Include user configuration */
+#include "msf_config.h"
+/* Include hardware definitions */
+#include "coredef.h"
+/* Include any standard headers, such as string.h */
+
+/* Include our main header*/
+#include "msf.h"
+/* Include the header for this module */
+#include "freqcnt.h"
+
+/* The low-power manager (msf_lowpower.c) also defines LPTimer_IRQHandler */
+#if MSF_LOWPOWER && FREQCNT_USE_LPTMR
+	#error FREQCNT_USE_LPTMR cannot be used together with MSF_LOWPOWER, which uses the LPTMR.
+#endif
+
+
+/* Defines section
+* Add all internally used #defines here
+*
+***************************************************/
+/* The clock of the LPTMR gate - the 1 kHz LPO */
+#define		FREQCNT_LPO_CLOCK		(1000UL)
+
+
+/* Variables section
+* Add all variables here
+*
+***************************************************/
+static MSF_DRIVER_TPM* gfreqcnt_counter;	/* the timer counting the edges */
+static MSF_DRIVER_TPM* gfreqcnt_gate;		/* the timer generating gate period; null = LPTMR */
+static FREQCNT_Event_t gfreqcnt_event;		/* user callback */
+static volatile uint32_t gfreqcnt_overflows;	/* overflows of the counter (upper 16 bits of the count) */
+static uint32_t gfreqcnt_last;				/* the count at the end of previous gate period */
+static uint32_t gfreqcnt_gate_clock;		/* clock of the gate timer in Hz */
+static uint32_t gfreqcnt_gate_ticks;		/* length of the gate period in gate timer ticks */
+static uint8_t gfreqcnt_valid;				/* gfreqcnt_last contains a valid count */
+static volatile uint32_t gfreqcnt_frequency;	/* the last result in Hz */
+
+
+/* Function Prototype Section
+* Add prototypes for all functions called by this
+* module, with the exception of runtime routines.
+*
+***************************************************/
+/* -------- Prototypes of internal functions   -------- */
+static void freqcnt_counter_event(uint32_t event, uint32_t arg);
+static void freqcnt_gate_event(uint32_t event, uint32_t arg);
+static void freqcnt_on_gate(void);
+
+
+/* Code section
+* Add the code for this module.
+*
+***************************************************/
+/* -------- Implementation of public functions   -------- */
+
+/*
+ * Start measuring the frequency
+ */
+uint8_t freqcnt_start(MSF_DRIVER_TPM* counter, MSF_DRIVER_TPM* gate, uint16_t gate_ms, FREQCNT_Event_t event)
+{
+	uint32_t ps;
+	uint64_t ticks = 0;
+
+	if ( counter == null || counter == gate || gate_ms == 0 )
+		return MSF_ERROR_ARGUMENT;
+#if !FREQCNT_USE_LPTMR
+	if ( gate == null )
+		return MSF_ERROR_ARGUMENT;
+#endif
+
+	/* find the smallest prescaler for which the gate period fits into the 16-bit counter */
+	if ( gate != null )
+	{
+		for ( ps = MSF_TPM_PRESCALER_1; ps <= MSF_TPM_PRESCALER_128; ps++ )
+		{
+			ticks = ((uint64_t)(WMSF_TPM_CLOCK >> ps) * gate_ms) / 1000;
+			if ( ticks <= 0x10000 )
+				break;
+		}
+		if ( ps > MSF_TPM_PRESCALER_128 || ticks < 2 )
+			return FREQCNT_ERROR_GATE;
+	}
+
+	gfreqcnt_counter = counter;
+	gfreqcnt_gate = gate;
+	gfreqcnt_event = event;
+	gfreqcnt_overflows = 0;
+	gfreqcnt_valid = 0;
+	gfreqcnt_frequency = 0;
+
+	/* The counter: external clock, 16-bit, overflows extend the count */
+	counter->Initialize(freqcnt_counter_event);
+	counter->Control(MSF_TPM_CLOCK_EXTERNAL | MSF_TPM_TOF_SIGNAL, 0);
+
+	if ( gate != null )
+	{
+		gfreqcnt_gate_clock = WMSF_TPM_CLOCK >> ps;
+		gfreqcnt_gate_ticks = (uint32_t)ticks;
+		gate->Initialize(freqcnt_gate_event);
+		gate->Control(MSF_TPM_PRESCALER_SET, ps);
+		gate->Control(MSF_TPM_MOD_VALUE | MSF_TPM_TOF_SIGNAL, gfreqcnt_gate_ticks - 1);
+	}
+#if FREQCNT_USE_LPTMR
+	else
+	{
+		gfreqcnt_gate_clock = FREQCNT_LPO_CLOCK;
+		gfreqcnt_gate_ticks = gate_ms;
+		SIM->SCGC5 |= SIM_SCGC5_LPTMR_MASK;
+		LPTMR0->CSR = 0;
+		/* LPO clock, prescaler bypassed */
+		LPTMR0->PSR = LPTMR_PSR_PCS(1) | LPTMR_PSR_PBYP_MASK;
+		LPTMR0->CMR = gate_ms - 1;
+		/* the same priority as the counter, so that the overflow count does not change
+		 * while the gate interrupt is handled */
+		NVIC_ClearPendingIRQ(LPTimer_IRQn);
+		NVIC_SetPriority(LPTimer_IRQn, MSF_TPM_INT_PRIORITY);
+		NVIC_EnableIRQ(LPTimer_IRQn);
+		LPTMR0->CSR = LPTMR_CSR_TCF_MASK | LPTMR_CSR_TIE_MASK | LPTMR_CSR_TEN_MASK;
+	}
+#endif
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Stop measuring the frequency
+ */
+void freqcnt_stop(void)
+{
+	if ( gfreqcnt_counter == null )
+		return;
+
+	if ( gfreqcnt_gate != null )
+		gfreqcnt_gate->Uninitialize();
+#if FREQCNT_USE_LPTMR
+	else
+	{
+		LPTMR0->CSR = LPTMR_CSR_TCF_MASK;
+		NVIC_DisableIRQ(LPTimer_IRQn);
+	}
+#endif
+	gfreqcnt_counter->Uninitialize();
+	gfreqcnt_counter = null;
+	gfreqcnt_valid = 0;
+}
+
+/*
+ * Get the last measured frequency
+ */
+uint32_t freqcnt_read(void)
+{
+	return gfreqcnt_frequency;
+}
+
+/* -------- Implementation of internal functions   -------- */
+
+/* Event handler of the counter timer - counts its overflows */
+static void freqcnt_counter_event(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_TPM_EVENT_TOF )
+		gfreqcnt_overflows++;
+}
+
+/* Event handler of the gate timer */
+static void freqcnt_gate_event(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_TPM_EVENT_TOF )
+		freqcnt_on_gate();
+}
+
+/* End of the gate period: read the count and compute the frequency.
+ * Both timer interrupts have the same priority, so the overflow counter
+ * cannot change here; an overflow not handled yet is reported by CounterRead. */
+static void freqcnt_on_gate(void)
+{
+	uint32_t cnt, total, edges;
+
+	cnt = gfreqcnt_counter->CounterRead();
+	total = ((gfreqcnt_overflows + ((cnt & MSF_TPM_COUNTER_TOF) ? 1 : 0)) << 16) + (cnt & 0xffff);
+
+	if ( gfreqcnt_valid )
+	{
+		edges = total - gfreqcnt_last;
+		gfreqcnt_frequency = (uint32_t)(((uint64_t)edges * gfreqcnt_gate_clock) / gfreqcnt_gate_ticks);
+		if ( gfreqcnt_event )
+			gfreqcnt_event(gfreqcnt_frequency);
+	}
+
+	gfreqcnt_last = total;
+	gfreqcnt_valid = 1;
+}
+
+#if FREQCNT_USE_LPTMR
+/* Interrupt handler for the LPTMR used as the gate */
+void LPTimer_IRQHandler(void)
+{
+	LPTMR0->CSR |= LPTMR_CSR_TCF_MASK;	/* clear the flag */
+	freqcnt_on_gate();
+}
+#endif
+
+/** @}*/
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * @file     freqcnt.h
+ * @brief    Frequency counter for high-frequency inputs
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef MSF_FREQCNT_H
+    #define MSF_FREQCNT_H
+
+/** @defgroup group_freqcnt freqcnt - frequency counter
+ * @{
+ * @brief Measures the frequency of a signal by counting its edges during a gate period.
+ * @details
+ * The measured signal is connected to the external clock input of a timer
+ * (TPM_CLKIN0 or TPM_CLKIN1, see WMSF_TPM_CLKIN and MSF_TPM_CLKIN_PIN in msf_config_mkl25z.h),
+ * so the edges are counted by the timer hardware and the CPU is not interrupted
+ * for each edge as in the input capture mode of waveio. This allows measuring signals
+ * of hundreds of kHz up to MHz range.<br>
+ * The gate period is generated by another timer (TPMn) or by the low-power timer (LPTMR).
+ * Once per gate period the number of edges counted is converted to frequency in Hz
+ * and reported to the callback function provided by the user.<br>
+ * <br>
+ * <b>Howto use the frequency counter</b><br>
+ * 1) Configure the pin for the external clock in msf_config.h, e.g.:<br>
+ * #define MSF_TPM_CLKIN_PIN	GPIO_B16<br>
+ * #define MSF_TPM_CLKIN_ALT	4<br>
+ * 2) Start the measurement: freqcnt_start(&Driver_TPM1, &Driver_TPM2, 100, my_callback);<br>
+ * 3) Get the results in the callback or by calling freqcnt_read().<br>
+ * <br>
+ * <b>Limitations</b><br>
+ * The external clock is synchronized to the internal TPM clock, so its frequency must be
+ * lower than 1/4 of the TPM clock (WMSF_TPM_CLOCK); e.g. 2 MHz for F_CPU 48 MHz.<br>
+ * The timers used by the frequency counter cannot be used by waveio or other code
+ * at the same time.<br>
+ * The KL25Z timers do not have a hardware gate input, so the counter runs all the time and
+ * its value is read in the interrupt at the end of each gate period. The result is the difference
+ * of two such readings, so the interrupt latency does not accumulate; it can only shift
+ * the edge count by one between two successive gate periods.<br>
+ * The LPTMR gate uses the 1 kHz LPO clock which has tolerance of several per cent,
+ * so it is suitable only for rough measurement.
+ *
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "drv_tpm.h"
+
+/* Defines section
+* Add all public #defines here
+*
+***************************************************/
+
+/** Allow using the LPTMR as the gate (gate parameter of freqcnt_start null).
+ * Defines the LPTimer_IRQHandler, so it is disabled by default.
+ * You can define this in your msf_config.h */
+#ifndef FREQCNT_USE_LPTMR
+	#define	FREQCNT_USE_LPTMR	(0)
+#endif
+
+/** Error codes returned by freqcnt functions */
+#define	FREQCNT_ERROR_GATE		(MSF_ERROR_LAST+1)	/**< the gate period is not possible with the given timer */
+
+/** @brief Callback function called once per gate period with the measured frequency in Hz.
+ * @note It is called from the timer interrupt handler.
+ */
+typedef void (*FREQCNT_Event_t)(uint32_t frequency);
+
+
+/* Function Prototype Section
+* Add prototypes for all public functions.
+* Write doxygen comments here!
+*
+***************************************************/
+
+/**
+ * @brief Start measuring the frequency.
+ * @param counter the timer which counts the edges of the measured signal on its external
+ *  clock input, e.g. &Driver_TPM1.
+ * @param gate the timer which generates the gate period, e.g. &Driver_TPM2. Must not be the same
+ *  as counter. If null, the LPTMR is used (only if FREQCNT_USE_LPTMR is set).
+ * @param gate_ms the gate period in milliseconds. The longer the gate period, the better
+ *  the resolution, which is 1000/gate_ms Hz. The maximum depends on the TPM clock:
+ *  1048 ms for TPM clock 8 MHz, 200 ms for 41.9 MHz. For the LPTMR it is 65535 ms.
+ * @param event the function to be called with the result once per gate period. Can be null.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT or FREQCNT_ERROR_GATE on error.
+ * @note The first result is available after two gate periods.
+ */
+uint8_t freqcnt_start(MSF_DRIVER_TPM* counter, MSF_DRIVER_TPM* gate, uint16_t gate_ms, FREQCNT_Event_t event);
+
+/**
+ * @brief Stop measuring the frequency.
+ * @note The timers are uninitialized; use Initialize to use them for other purposes.
+ */
+void freqcnt_stop(void);
+
+/**
+ * @brief Get the frequency measured in the last gate period.
+ * @return the frequency in Hz; 0 if no result is available yet.
+ */
+uint32_t freqcnt_read(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+/* ----------- end of file -------------- */
+#endif /* MSF_FREQCNT_H */
@@ -0,0 +1,396 @@
+/****************************************************************************
+ * @file     pt.c
+ * @brief    Protothreads - awaitable driver operations
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	The protothread macros are in pt.h. This file contains the driver
+ * 			callbacks which complete the PT_OP operations.
+ *
+ ******************************************************************************/
+
+/** @addtogroup group_pt
+ * @{
+ */
+
+/* Include section
+* Add all #includes here
+*
+***************************************************/
+/* Include user configuration */
+#include "msf_config.h"
+/* Include hardware definitions */
+#include "coredef.h"
+/* Include any standard headers, such as string.h */
+
+/* Include our main header*/
+#include "msf.h"
+/* Include the header for this module */
+#include "pt.h"
+
+
+/* Defines section
+* Add all internally used #defines here
+*
+***************************************************/
+/* Number of UART and TPM drivers */
+#define		PT_MAX_UARTS		(3)
+#define		PT_MAX_TPMS			(3)
+
+
+/* Variables section
+* Add all variables here
+*
+***************************************************/
+/* The operations in progress for each UART; null if none */
+static PT_OP* volatile gpt_uart_rx[PT_MAX_UARTS];
+static PT_OP* volatile gpt_uart_tx[PT_MAX_UARTS];
+
+/* Bit n set = UART n was initialized by pt_uart_init */
+static uint8_t gpt_uart_init;
+
+/* The ADC conversion in progress */
+static PT_OP* volatile gpt_adc;
+static uint8_t gpt_adc_init;
+
+/* The operation waiting for each channel of each timer */
+static PT_OP* volatile gpt_capture[PT_MAX_TPMS][6];
+/* The channel handler which was installed before pt_capture_start; restored by pt_capture_stop */
+static MSF_TPM_Channel_Event_t gpt_capture_prev[PT_MAX_TPMS][6];
+
+/* Number of channels of each timer */
+static const uint8_t gpt_nchannels[PT_MAX_TPMS] = { 6, 2, 2 };
+
+
+/* Function Prototype Section
+* Add prototypes for all functions called by this
+* module, with the exception of runtime routines.
+*
+***************************************************/
+/* -------- Prototypes of internal functions   -------- */
+static void pt_uart0_event(uint32_t event, uint32_t arg);
+static void pt_uart1_event(uint32_t event, uint32_t arg);
+static void pt_uart2_event(uint32_t event, uint32_t arg);
+static void pt_uart_event(uint8_t index, uint32_t event);
+static uint8_t pt_uart_index(MSF_DRIVER_USART* uart);
+#if (MSF_DRIVER_ADC0)
+static void pt_adc_event(uint32_t event, uint32_t arg);
+#endif
+static void pt_tpm0_channel(uint32_t channel, uint32_t value);
+static void pt_tpm1_channel(uint32_t channel, uint32_t value);
+static void pt_tpm2_channel(uint32_t channel, uint32_t value);
+static void pt_on_capture(uint8_t tpm_index, uint32_t channel, uint32_t value);
+static uint8_t pt_tpm_index(MSF_DRIVER_TPM* tpm);
+static uint8_t pt_op_begin(PT_OP* volatile* slot, PT_OP* op);
+
+/* The event handlers for the UARTs */
+static const MSF_UART_Event_t gpt_uart_events[PT_MAX_UARTS] =
+	{ pt_uart0_event, pt_uart1_event, pt_uart2_event };
+/* The channel handlers for the timers */
+static const MSF_TPM_Channel_Event_t gpt_tpm_channels[PT_MAX_TPMS] =
+	{ pt_tpm0_channel, pt_tpm1_channel, pt_tpm2_channel };
+
+
+/* Code section
+* Add the code for this module.
+*
+***************************************************/
+/* -------- Implementation of public functions   -------- */
+
+/*
+ * Initialize the UART for awaitable operations
+ */
+uint8_t pt_uart_init(MSF_DRIVER_USART* uart, UART_speed_t baudrate)
+{
+	uint8_t index = pt_uart_index(uart);
+
+	if ( index >= PT_MAX_UARTS )
+		return MSF_ERROR_ARGUMENT;
+
+	gpt_uart_rx[index] = null;
+	gpt_uart_tx[index] = null;
+	uart->Initialize(baudrate, gpt_uart_events[index]);
+	uart->Control(MSF_UART_INT_MODE, 0);
+	gpt_uart_init |= (1 << index);
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Start receiving data
+ */
+uint8_t pt_uart_receive(MSF_DRIVER_USART* uart, PT_OP* op, void* data, uint32_t cnt)
+{
+	uint8_t index = pt_uart_index(uart);
+	uint8_t err;
+
+	if ( index >= PT_MAX_UARTS || op == null || data == null || cnt == 0 )
+		return MSF_ERROR_ARGUMENT;
+	if ( (gpt_uart_init & (1 << index)) == 0 )
+		return MSF_ERROR_NOINIT;
+
+	err = pt_op_begin(&gpt_uart_rx[index], op);
+	if ( err == MSF_ERROR_OK )
+		uart->Receive(data, cnt);
+	return err;
+}
+
+/*
+ * Start sending data
+ */
+uint8_t pt_uart_send(MSF_DRIVER_USART* uart, PT_OP* op, const void* data, uint32_t cnt)
+{
+	uint8_t index = pt_uart_index(uart);
+	uint8_t err;
+
+	if ( index >= PT_MAX_UARTS || op == null || data == null || cnt == 0 )
+		return MSF_ERROR_ARGUMENT;
+	if ( (gpt_uart_init & (1 << index)) == 0 )
+		return MSF_ERROR_NOINIT;
+
+	err = pt_op_begin(&gpt_uart_tx[index], op);
+	if ( err == MSF_ERROR_OK )
+		uart->Send(data, cnt);
+	return err;
+}
+
+/*
+ * Initialize the ADC for awaitable conversions
+ */
+uint8_t pt_adc_init(void)
+{
+#if (MSF_DRIVER_ADC0)
+	gpt_adc = null;
+	/* The ADC is initialized (and calibrated) by msf_init; only install the callback
+	 * so the resolution and other settings of the program are kept */
+#if !MSF_USE_ANALOG
+	Driver_ADC0.Initialize(null);
+#endif
+	Driver_ADC0.Control(MSF_ADC_EVENT_SET | MSF_ADC_CONV_SINGLE | MSF_ADC_MODE_INT, (uint32_t)pt_adc_event);
+	gpt_adc_init = 1;
+	return MSF_ERROR_OK;
+#else
+	return MSF_ERROR_NOTSUPPORTED;
+#endif
+}
+
+/*
+ * Start the conversion
+ */
+uint8_t pt_adc_start(PT_OP* op, uint32_t channel)
+{
+	uint8_t err;
+
+	if ( op == null )
+		return MSF_ERROR_ARGUMENT;
+	if ( !gpt_adc_init )
+		return MSF_ERROR_NOINIT;
+
+	err = pt_op_begin(&gpt_adc, op);
+#if (MSF_DRIVER_ADC0)
+	if ( err == MSF_ERROR_OK )
+	{
+		Driver_ADC0.SetChannel(channel);
+		Driver_ADC0.Read();		/* only starts the conversion in interrupt mode */
+	}
+#else
+	(void)channel;
+#endif
+	return err;
+}
+
+/*
+ * Wait for the next capture on the timer channel
+ */
+uint8_t pt_capture_start(PT_OP* op, MSF_DRIVER_TPM* tpm, uint8_t channel)
+{
+	uint8_t index = pt_tpm_index(tpm);
+
+	if ( op == null || index >= PT_MAX_TPMS || channel >= gpt_nchannels[index] )
+		return MSF_ERROR_ARGUMENT;
+
+	MSF_ATOMIC_BEGIN();
+	op->done = 0;
+	op->result = 0;
+	if ( gpt_capture[index][channel] == null )
+	{
+		gpt_capture_prev[index][channel] = tpm->ChannelGetHandler(channel);
+		tpm->ChannelSetHandler(channel, gpt_tpm_channels[index]);
+	}
+	gpt_capture[index][channel] = op;
+	MSF_ATOMIC_END();
+
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Stop waiting for captures on the timer channel
+ */
+void pt_capture_stop(MSF_DRIVER_TPM* tpm, uint8_t channel)
+{
+	uint8_t index = pt_tpm_index(tpm);
+
+	if ( index >= PT_MAX_TPMS || channel >= gpt_nchannels[index] )
+		return;
+
+	MSF_ATOMIC_BEGIN();
+	if ( gpt_capture[index][channel] != null )
+	{
+		tpm->ChannelSetHandler(channel, gpt_capture_prev[index][channel]);
+		gpt_capture_prev[index][channel] = null;
+	}
+	gpt_capture[index][channel] = null;
+	MSF_ATOMIC_END();
+}
+
+
+/* -------- Implementation of internal functions   -------- */
+
+/* Register the operation as the one in progress in the slot
+ * return PT_ERROR_BUSY if another operation in the slot is not complete */
+static uint8_t pt_op_begin(PT_OP* volatile* slot, PT_OP* op)
+{
+	MSF_ATOMIC_BEGIN();
+	if ( *slot != null && !(*slot)->done )
+	{
+		MSF_ATOMIC_END();
+		return PT_ERROR_BUSY;
+	}
+	op->done = 0;
+	op->result = 0;
+	*slot = op;
+	MSF_ATOMIC_END();
+
+	return MSF_ERROR_OK;
+}
+
+/* Get the index of the UART driver; PT_MAX_UARTS if not known */
+static uint8_t pt_uart_index(MSF_DRIVER_USART* uart)
+{
+#if (MSF_DRIVER_UART0)
+	if ( uart == &Driver_UART0 )
+		return 0;
+#endif
+#if (MSF_DRIVER_UART1)
+	if ( uart == &Driver_UART1 )
+		return 1;
+#endif
+#if (MSF_DRIVER_UART2)
+	if ( uart == &Driver_UART2 )
+		return 2;
+#endif
+	return PT_MAX_UARTS;
+}
+
+/* Get the index of the timer driver; PT_MAX_TPMS if not known */
+static uint8_t pt_tpm_index(MSF_DRIVER_TPM* tpm)
+{
+#if (MSF_DRIVER_TPM0)
+	if ( tpm == &Driver_TPM0 )
+		return 0;
+#endif
+#if (MSF_DRIVER_TPM1)
+	if ( tpm == &Driver_TPM1 )
+		return 1;
+#endif
+#if (MSF_DRIVER_TPM2)
+	if ( tpm == &Driver_TPM2 )
+		return 2;
+#endif
+	return PT_MAX_TPMS;
+}
+
+/* Process the event of the UART; called from the interrupt */
+static void pt_uart_event(uint8_t index, uint32_t event)
+{
+	PT_OP* op;
+
+	switch ( event )
+	{
+	case MSF_UART_EVENT_RECEIVE_COMPLETE:
+		op = gpt_uart_rx[index];
+		if ( op != null )
+		{
+			op->result |= event;
+			op->done = 1;
+		}
+		break;
+
+	case MSF_UART_EVENT_RX_OVERFLOW:
+		/* the receive continues; the thread can check the flag when it completes */
+		op = gpt_uart_rx[index];
+		if ( op != null && !op->done )
+			op->result |= event;
+		break;
+
+	case MSF_UART_EVENT_SEND_COMPLETE:
+		op = gpt_uart_tx[index];
+		if ( op != null )
+		{
+			op->result |= event;
+			op->done = 1;
+		}
+		break;
+	}
+}
+
+/* Event handlers of the UARTs */
+static void pt_uart0_event(uint32_t event, uint32_t arg)
+{
+	pt_uart_event(0, event);
+}
+
+static void pt_uart1_event(uint32_t event, uint32_t arg)
+{
+	pt_uart_event(1, event);
+}
+
+static void pt_uart2_event(uint32_t event, uint32_t arg)
+{
+	pt_uart_event(2, event);
+}
+
+#if (MSF_DRIVER_ADC0)
+/* Event handler of the ADC */
+static void pt_adc_event(uint32_t event, uint32_t arg)
+{
+	PT_OP* op = gpt_adc;
+
+	if ( (event & MSF_ADC_EVENT_CONV_COMPLETE) && op != null )
+	{
+		op->result = arg;
+		op->done = 1;
+	}
+}
+#endif	/* MSF_DRIVER_ADC0 */
+
+/* Process the capture of a timer channel; only the first edge after
+ * pt_capture_start completes the operation */
+static void pt_on_capture(uint8_t tpm_index, uint32_t channel, uint32_t value)
+{
+	PT_OP* op = gpt_capture[tpm_index][channel];
+
+	if ( op != null && !op->done )
+	{
+		op->result = value;
+		op->done = 1;
+	}
+}
+
+/* Channel handlers of the timers */
+static void pt_tpm0_channel(uint32_t channel, uint32_t value)
+{
+	pt_on_capture(0, channel, value);
+}
+
+static void pt_tpm1_channel(uint32_t channel, uint32_t value)
+{
+	pt_on_capture(1, channel, value);
+}
+
+static void pt_tpm2_channel(uint32_t channel, uint32_t value)
+{
+	pt_on_capture(2, channel, value);
+}
+
+/** @}*/
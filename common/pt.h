@@ -0,0 +1,235 @@
+/****************************************************************************
+ * @file     pt.h
+ * @brief    Protothreads - stackless threads with awaitable driver operations
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	The local continuations are based on the protothreads library
+ * 			by Adam Dunkels (switch statement and __LINE__).
+ *
+ ******************************************************************************/
+#ifndef MSF_PT_H
+    #define MSF_PT_H
+
+/** @defgroup group_pt pt - protothreads
+ * @{
+ * @brief Sequential code which waits for I/O without blocking the CPU and without own stack.
+ * @details
+ * A protothread is a function which can wait for a condition in the middle of its code,
+ * e.g. for the UART to receive a command or for the ADC to complete the conversion.
+ * When it waits, the function returns to the caller (the main loop), which calls it again
+ * later; the function then continues from the place where it waited. So many sequences of
+ * operations can run "at the same time" as simple sequential code, instead of hand-written
+ * state machines. All the threads share the stack of main; each thread needs only 2 bytes
+ * of RAM (the PT structure) for its state.<br>
+ * <br>
+ * <b>Howto use the protothreads</b><br>
+ * 1) Declare the state of the thread: static PT pt_rx;<br>
+ * 2) Write the thread:<br>
+ * PT_THREAD(rx_thread(PT* pt))<br>
+ * {<br>
+ * &nbsp;	PT_BEGIN(pt);<br>
+ * &nbsp;	while (1) {<br>
+ * &nbsp;&nbsp;		pt_uart_receive(&Driver_UART0, &rx_op, buffer, 5);<br>
+ * &nbsp;&nbsp;		PT_AWAIT(pt, &rx_op);<br>
+ * &nbsp;&nbsp;		...process the data in buffer...<br>
+ * &nbsp;	}<br>
+ * &nbsp;	PT_END(pt);<br>
+ * }<br>
+ * 3) Initialize it: PT_INIT(&pt_rx);<br>
+ * 4) Call it repeatedly from the main loop: while (1) { rx_thread(&pt_rx); other_thread(&pt_other); }<br>
+ * <br>
+ * <b>Limits</b><br>
+ * The local variables of the thread are NOT preserved while it waits; use static
+ * variables or a structure passed to the thread. The PT_ macros which wait (PT_WAIT_UNTIL,
+ * PT_AWAIT, PT_YIELD...) cannot be used inside a switch statement in the thread,
+ * because they are implemented by switch themselves, and only in the thread function itself,
+ * not in the functions it calls (use PT_SPAWN for nested threads). The place where the thread
+ * waits is identified by the line number, so put at most one of these macros on each line.<br>
+ * <br>
+ * <b>Awaitable operations</b><br>
+ * The functions pt_uart_receive, pt_uart_send, pt_adc_start and pt_capture_start start
+ * the operation in the driver in interrupt mode and return immediately. The PT_OP given to
+ * them is marked as done from the driver callback when the operation completes;
+ * the thread waits for it by PT_AWAIT. The UART and ADC must be initialized by
+ * pt_uart_init and pt_adc_init, which install the callbacks of this module.
+ * For the input capture the program initializes the timer itself (prescaler, channel mode)
+ * and pt_capture_start installs the channel handler.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "drv_uart.h"
+#include "drv_adc.h"
+#include "drv_tpm.h"
+
+/* Defines section
+* Add all public #defines here
+*
+***************************************************/
+
+/** Values returned by the thread function */
+#define	PT_WAITING		(0)		/**< the thread waits for a condition */
+#define	PT_YIELDED		(1)		/**< the thread gave up the CPU by PT_YIELD */
+#define	PT_EXITED		(2)		/**< the thread exited by PT_EXIT */
+#define	PT_ENDED		(3)		/**< the thread reached PT_END */
+
+/** Error codes returned by pt functions */
+#define	PT_ERROR_BUSY	(MSF_ERROR_LAST+1)	/**< the previous operation is not complete yet */
+
+/** @brief The state of the thread (the place where it waits). */
+typedef struct pt
+{
+	uint16_t	lc;		/* local continuation - the line where the thread continues */
+} PT;
+
+/** @brief The awaitable operation; completed from the driver callback.
+ * @note The program reads the members, but does not write them.
+ */
+typedef struct pt_op
+{
+	volatile uint32_t	result;	/**< UART: the events (MSF_UART_EVENT_RX_OVERFLOW is reported here);
+									ADC: the result; input capture: the captured counter value */
+	volatile uint8_t	done;	/**< 1 when the operation is complete */
+} PT_OP;
+
+/** Declare the thread function, e.g. PT_THREAD(my_thread(PT* pt)) */
+#define	PT_THREAD(name_args)		char name_args
+
+/** Initialize the thread; it will start from PT_BEGIN on the next call */
+#define	PT_INIT(pt)					((pt)->lc = 0)
+
+/** Start of the thread code; must be the first statement of the thread function */
+#define	PT_BEGIN(pt)				{ char pt_yield_flag = 1; (void)pt_yield_flag; \
+									switch ( (pt)->lc ) { case 0:
+
+/** End of the thread code; the thread starts again from the beginning when called again */
+#define	PT_END(pt)					} PT_INIT(pt); return PT_ENDED; }
+
+/* Internal: remember the current line so the thread continues here */
+#define	WPT_SET(pt)					(pt)->lc = __LINE__; case __LINE__:
+
+/** Wait until the condition is true; it is evaluated each time the thread is called */
+#define	PT_WAIT_UNTIL(pt, cond)		do { WPT_SET(pt); if ( !(cond) ) return PT_WAITING; } while (0)
+
+/** Wait while the condition is true */
+#define	PT_WAIT_WHILE(pt, cond)		PT_WAIT_UNTIL((pt), !(cond))
+
+/** Give up the CPU once; the thread continues on the next call */
+#define	PT_YIELD(pt)				do { pt_yield_flag = 0; WPT_SET(pt); \
+									if ( pt_yield_flag == 0 ) return PT_YIELDED; } while (0)
+
+/** Exit the thread; it will start from the beginning when called again */
+#define	PT_EXIT(pt)					do { PT_INIT(pt); return PT_EXITED; } while (0)
+
+/** Start the thread again from the beginning on the next call */
+#define	PT_RESTART(pt)				do { PT_INIT(pt); return PT_WAITING; } while (0)
+
+/** Run the thread once; true if it did not exit or end yet */
+#define	PT_SCHEDULE(f)				((f) < PT_EXITED)
+
+/** Wait until the child thread exits or ends, e.g. PT_WAIT_THREAD(pt, child_thread(&pt_child)) */
+#define	PT_WAIT_THREAD(pt, thread)	PT_WAIT_WHILE((pt), PT_SCHEDULE(thread))
+
+/** Start the child thread and wait until it exits or ends */
+#define	PT_SPAWN(pt, child, thread)	do { PT_INIT(child); PT_WAIT_THREAD((pt), (thread)); } while (0)
+
+/** Wait until the operation started by pt_ function completes; then read op->result */
+#define	PT_AWAIT(pt, op)			PT_WAIT_UNTIL((pt), (op)->done)
+
+/** Wait given number of ms; t is uint32_t variable which keeps the start time
+ * (must be static or in a structure, like all the variables of the thread) */
+#define	PT_DELAY_MS(pt, t, ms)		do { (t) = msf_millis(); \
+									PT_WAIT_UNTIL((pt), (msf_millis() - (t)) >= (uint32_t)(ms)); } while (0)
+
+
+/* Function Prototype Section
+* Add prototypes for all public functions.
+* Write doxygen comments here!
+*
+***************************************************/
+
+/**
+ * @brief Initialize the UART driver for the awaitable operations.
+ * @param uart the driver, e.g. &Driver_UART0
+ * @param baudrate the baudrate, e.g. BD9600
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the driver is not known.
+ * @note Puts the driver into interrupt mode with the callback of this module, so the
+ * driver cannot be used by coniob or msf_print at the same time.
+ */
+uint8_t pt_uart_init(MSF_DRIVER_USART* uart, UART_speed_t baudrate);
+
+/**
+ * @brief Start receiving data in the background; wait for it by PT_AWAIT(pt, op).
+ * @param uart the driver initialized by pt_uart_init
+ * @param op the operation; completed when cnt bytes are received
+ * @param data the buffer for the data; must exist until the operation completes
+ * @param cnt the number of bytes to receive, at least 1
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_NOINIT if pt_uart_init was not called;
+ *  PT_ERROR_BUSY if the previous receive is not complete; MSF_ERROR_ARGUMENT.
+ */
+uint8_t pt_uart_receive(MSF_DRIVER_USART* uart, PT_OP* op, void* data, uint32_t cnt);
+
+/**
+ * @brief Start sending data in the background; wait for it by PT_AWAIT(pt, op).
+ * @param uart the driver initialized by pt_uart_init
+ * @param op the operation; completed when the last byte is written to the transmitter
+ * @param data the data to send; must exist until the operation completes
+ * @param cnt the number of bytes to send, at least 1
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_NOINIT if pt_uart_init was not called;
+ *  PT_ERROR_BUSY if the previous send is not complete; MSF_ERROR_ARGUMENT.
+ */
+uint8_t pt_uart_send(MSF_DRIVER_USART* uart, PT_OP* op, const void* data, uint32_t cnt);
+
+/**
+ * @brief Initialize the ADC driver (Driver_ADC0) for the awaitable conversions.
+ * @return MSF_ERROR_OK (0) if OK
+ * @note Sets the ADC to single conversion in interrupt mode and installs the callback of
+ * this module (Control with MSF_ADC_EVENT_SET). The ADC initialized by msf_init is not
+ * initialized again, so its calibration and the resolution and other settings made by
+ * Driver_ADC0.Control are kept.
+ */
+uint8_t pt_adc_init(void);
+
+/**
+ * @brief Start the conversion; wait for it by PT_AWAIT(pt, op) and read the value from op->result.
+ * @param op the operation
+ * @param channel the ADC channel, see Driver_ADC0.SetChannel
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_NOINIT if pt_adc_init was not called;
+ *  PT_ERROR_BUSY if the previous conversion is not complete.
+ */
+uint8_t pt_adc_start(PT_OP* op, uint32_t channel);
+
+/**
+ * @brief Wait for the next capture on the timer channel; wait for it by PT_AWAIT(pt, op)
+ * and read the captured counter value from op->result.
+ * @param op the operation; completed by the first edge captured after this call.
+ *  The edges captured before the next call are ignored.
+ * @param tpm the timer, e.g. &Driver_TPM0; must be initialized and the channel set to input
+ *  capture mode with MSF_TPM_PARAM_CHANNEL_EVENT by the program.
+ * @param channel the channel of the timer
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the timer or channel is not valid.
+ * @note The channel handler is installed on the first call; the handler installed before
+ * is restored by pt_capture_stop. The driver Initialize removes the handler, so call
+ * pt_capture_stop before initializing the timer again.
+ */
+uint8_t pt_capture_start(PT_OP* op, MSF_DRIVER_TPM* tpm, uint8_t channel);
+
+/**
+ * @brief Stop waiting for captures on the timer channel; restores the channel handler
+ * which was installed before pt_capture_start (null if none).
+ * @param tpm the timer
+ * @param channel the channel of the timer
+ */
+void pt_capture_stop(MSF_DRIVER_TPM* tpm, uint8_t channel);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+/* ----------- end of file -------------- */
+#endif /* MSF_PT_H */
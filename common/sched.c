@@ -0,0 +1,247 @@
+/****************************************************************************
+ * @file     sched.c
+ * @brief    Cooperative run-to-completion task scheduler
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note	The ready tasks are bits in a 32-bit mask; the task with the highest
+ * 			priority is found by isolating the lowest set bit and a de Bruijn
+ * 			multiplication, so the dispatch takes the same time for any number of tasks.
+ *
+ ******************************************************************************/
+
+/** @addtogroup group_sched
+ * @{
+ */
+
+/* Include section
+* Add all #includes here
+*
+***************************************************/
+#if SCHED_HOST
+/* Build for PC - only standard headers */
+#include <stdint.h>
+#include <stddef.h>
+#define		null				NULL
+#define		MSF_ERROR_OK		(0)
+#define		MSF_ERROR_ARGUMENT	(6)
+#define		MSF_ATOMIC_BEGIN()
+#define		MSF_ATOMIC_END()
+#else
+/* Include user configuration */
+#include "msf_config.h"
+/* Include hardware definitions */
+#include "coredef.h"
+/* Include our main header*/
+#include "msf.h"
+#endif
+/* Include the header for this module */
+#include "sched.h"
+
+
+/* Defines section
+* Add all internally used #defines here
+*
+***************************************************/
+#if SCHED_MAX_TASKS < 1 || SCHED_MAX_TASKS > 32
+	#error "SCHED_MAX_TASKS must be 1 thru 32"
+#endif
+
+/* de Bruijn sequence for finding the index of the lowest set bit */
+#define		SCHED_DEBRUIJN		(0x077CB531UL)
+
+
+/* Variables section
+* Add all variables here
+*
+***************************************************/
+static SCHED_Task_t gsched_tasks[SCHED_MAX_TASKS];
+static volatile uint32_t gsched_events[SCHED_MAX_TASKS];
+static volatile uint32_t gsched_ready;		/* bit n set = task n has events */
+static SCHED_STATS gsched_stats;
+#if SCHED_MEASURE
+static SCHED_TASK_STATS gsched_task_stats[SCHED_MAX_TASKS];
+#endif
+
+/* Index of the lowest set bit for the de Bruijn product */
+static const uint8_t gsched_bit_index[32] =
+{
+	0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+	31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+
+/* Code section
+* Add the code for this module.
+*
+***************************************************/
+/* -------- Implementation of public functions   -------- */
+
+/*
+ * Create a task
+ */
+uint8_t sched_task_create(uint8_t priority, SCHED_Task_t task)
+{
+	if ( priority >= SCHED_MAX_TASKS || task == null || gsched_tasks[priority] != null )
+		return MSF_ERROR_ARGUMENT;
+
+	MSF_ATOMIC_BEGIN();
+	gsched_events[priority] = 0;
+	gsched_ready &= ~(1UL << priority);
+	gsched_tasks[priority] = task;
+	MSF_ATOMIC_END();
+#if SCHED_MEASURE
+	gsched_task_stats[priority].runs = 0;
+	gsched_task_stats[priority].time_last = 0;
+	gsched_task_stats[priority].time_max = 0;
+#endif
+	return MSF_ERROR_OK;
+}
+
+/*
+ * Delete a task
+ */
+void sched_task_delete(uint8_t priority)
+{
+	if ( priority >= SCHED_MAX_TASKS )
+		return;
+
+	MSF_ATOMIC_BEGIN();
+	gsched_tasks[priority] = null;
+	gsched_events[priority] = 0;
+	gsched_ready &= ~(1UL << priority);
+	MSF_ATOMIC_END();
+}
+
+/*
+ * Post events to a task
+ */
+void sched_post(uint8_t priority, uint32_t events)
+{
+	if ( priority >= SCHED_MAX_TASKS || events == 0 )
+		return;
+
+	MSF_ATOMIC_BEGIN();
+	if ( gsched_tasks[priority] != null )
+	{
+		gsched_events[priority] |= events;
+		gsched_ready |= (1UL << priority);
+	}
+	MSF_ATOMIC_END();
+}
+
+/*
+ * Run the ready task with the highest priority
+ */
+uint8_t sched_dispatch(void)
+{
+	uint32_t ready, events;
+	uint8_t index;
+	SCHED_Task_t task;
+#if SCHED_MEASURE
+	uint32_t start, run, end;
+
+	start = SCHED_TIMESTAMP();
+#endif
+
+	if ( gsched_ready == 0 )
+		return 0;
+
+	MSF_ATOMIC_BEGIN();
+	ready = gsched_ready;
+	/* the lowest set bit is the highest priority; ready & -ready isolates it */
+	index = gsched_bit_index[(uint32_t)((ready & (0 - ready)) * SCHED_DEBRUIJN) >> 27];
+	events = gsched_events[index];
+	gsched_events[index] = 0;
+	gsched_ready = ready & ~(1UL << index);
+	task = gsched_tasks[index];
+	MSF_ATOMIC_END();
+
+#if SCHED_MEASURE
+	run = SCHED_TIMESTAMP();
+#endif
+	task(events);
+	gsched_stats.dispatches++;
+
+#if SCHED_MEASURE
+	end = SCHED_TIMESTAMP();
+	if ( run - start > gsched_stats.overhead_max )
+		gsched_stats.overhead_max = run - start;
+	gsched_task_stats[index].runs++;
+	gsched_task_stats[index].time_last = end - run;
+	if ( end - run > gsched_task_stats[index].time_max )
+		gsched_task_stats[index].time_max = end - run;
+#endif
+	return 1;
+}
+
+/*
+ * Run the tasks forever
+ */
+void sched_run(void)
+{
+	while ( 1 )
+	{
+		if ( sched_dispatch() )
+			continue;
+
+		/* Nothing to do. The ready mask must be checked with the interrupts disabled,
+		 * otherwise an event posted just before the WFI would wait for the next interrupt */
+		MSF_ATOMIC_BEGIN();
+		if ( gsched_ready == 0 )
+		{
+			gsched_stats.idle++;
+			SCHED_IDLE();
+		}
+		MSF_ATOMIC_END();
+	}
+}
+
+/*
+ * Get the statistics of the scheduler
+ */
+void sched_get_stats(SCHED_STATS* stats)
+{
+	if ( stats != null )
+		*stats = gsched_stats;
+}
+
+/*
+ * Get the statistics of a task
+ */
+void sched_get_task_stats(uint8_t priority, SCHED_TASK_STATS* stats)
+{
+	if ( stats == null || priority >= SCHED_MAX_TASKS )
+		return;
+#if SCHED_MEASURE
+	*stats = gsched_task_stats[priority];
+#else
+	stats->runs = 0;
+	stats->time_last = 0;
+	stats->time_max = 0;
+#endif
+}
+
+/*
+ * Reset the statistics
+ */
+void sched_reset_stats(void)
+{
+	uint8_t i;
+
+	gsched_stats.dispatches = 0;
+	gsched_stats.idle = 0;
+	gsched_stats.overhead_max = 0;
+#if SCHED_MEASURE
+	for ( i = 0; i < SCHED_MAX_TASKS; i++ )
+	{
+		gsched_task_stats[i].runs = 0;
+		gsched_task_stats[i].time_last = 0;
+		gsched_task_stats[i].time_max = 0;
+	}
+#else
+	(void)i;
+#endif
+}
+
+/** @}*/
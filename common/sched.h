@@ -0,0 +1,186 @@
+/****************************************************************************
+ * @file     sched.h
+ * @brief    Cooperative run-to-completion task scheduler
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef MSF_SCHED_H
+    #define MSF_SCHED_H
+
+/** @defgroup group_sched sched - cooperative task scheduler
+ * @{
+ * @brief Runs tasks in the main context when events are posted to them.
+ * @details
+ * Instead of polling all the inputs in one big loop, the program is divided into tasks.
+ * A task is a function which is called when some event is posted to it, e.g. by an interrupt
+ * handler (data received by UART, edge captured by TPM, ADC conversion complete) or by
+ * another task. The task runs to completion; it is not preempted by other tasks,
+ * only by interrupts. If no task is ready, the CPU sleeps (WFI) until an interrupt occurs.<br>
+ * Each task has a fixed priority, which is also its identifier: 0 is the highest priority,
+ * SCHED_MAX_TASKS - 1 the lowest. If more tasks are ready, the one with the highest priority
+ * runs first.<br>
+ * The events are bits in a 32-bit value; their meaning is defined by the program.
+ * Events posted to a task which did not run yet are merged (OR-ed), so the task receives
+ * all the events posted since its last run at once.<br>
+ * <br>
+ * <b>Howto use the scheduler</b><br>
+ * 1) Write the tasks: void uart_task(uint32_t events) { if (events & EV_RX) ... }<br>
+ * 2) Create them: sched_task_create(0, uart_task); sched_task_create(1, ui_task);<br>
+ * 3) Post events from interrupt handlers (or the driver callbacks): sched_post(0, EV_RX);<br>
+ * 4) Call sched_run() at the end of main; it does not return.<br>
+ * Periodic events can be posted from the software timer (msf_timer_set) callback.<br>
+ * <br>
+ * <b>Timing</b><br>
+ * Selecting the task to run takes constant time regardless of the number of tasks
+ * (no loop over the tasks). The scheduler measures its overhead per dispatch and the run time
+ * of each task, see sched_get_stats and sched_get_task_stats. The time is measured by
+ * SCHED_TIMESTAMP(), by default msf_ticks32().<br>
+ * <br>
+ * <b>Host build</b><br>
+ * The scheduler does not access the hardware directly. If compiled with SCHED_HOST defined
+ * as 1 (e.g. -DSCHED_HOST=1), it needs only standard C headers, so it can be built
+ * on a PC and tested deterministically by calling sched_post and sched_dispatch
+ * (see test/host/sched_test.c). The measurement is off by default in such build;
+ * if you enable SCHED_MEASURE, define SCHED_TIMESTAMP() to your own time source.
+ *
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Defines section
+* Add all public #defines here
+*
+***************************************************/
+
+/** Maximum number of tasks; 1 thru 32.
+ * You can define this in your msf_config.h */
+#ifndef SCHED_MAX_TASKS
+	#define	SCHED_MAX_TASKS		(8)
+#endif
+
+/** Measure the time of the dispatches and tasks (1) or not (0).
+ * You can define this in your msf_config.h */
+#ifndef SCHED_MEASURE
+	#if SCHED_HOST
+		#define	SCHED_MEASURE		(0)
+	#else
+		#define	SCHED_MEASURE		(1)
+	#endif
+#endif
+
+/** The time source for the measurement; 32-bit value which increments with the clock */
+#ifndef SCHED_TIMESTAMP
+	#if SCHED_HOST
+		#define	SCHED_TIMESTAMP()	((uint32_t)0)
+	#else
+		#define	SCHED_TIMESTAMP()	msf_ticks32()
+	#endif
+#endif
+
+/** What to do when no task is ready; called with interrupts disabled.
+ * WFI wakes up on interrupt even if the interrupts are disabled. */
+#ifndef SCHED_IDLE
+	#if SCHED_HOST
+		#define	SCHED_IDLE()
+	#else
+		#define	SCHED_IDLE()	__WFI()
+	#endif
+#endif
+
+/** @brief The task function.
+ * @param events the events posted to the task since its last run
+ */
+typedef void (*SCHED_Task_t)(uint32_t events);
+
+/** @brief Statistics of the scheduler */
+typedef struct sched_stats
+{
+	uint32_t	dispatches;		/**< number of task runs */
+	uint32_t	idle;			/**< number of times the CPU went to sleep */
+	uint32_t	overhead_max;	/**< maximum time to select the task and get its events */
+} SCHED_STATS;
+
+/** @brief Statistics of a task */
+typedef struct sched_task_stats
+{
+	uint32_t	runs;			/**< number of runs */
+	uint32_t	time_last;		/**< the time of the last run */
+	uint32_t	time_max;		/**< the longest run */
+} SCHED_TASK_STATS;
+
+
+/* Function Prototype Section
+* Add prototypes for all public functions.
+* Write doxygen comments here!
+*
+***************************************************/
+
+/**
+ * @brief Create a task.
+ * @param priority the priority of the task; 0 (highest) thru SCHED_MAX_TASKS - 1.
+ *  It is also the identifier of the task used by the other functions.
+ * @param task the task function
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the priority is out of range
+ *  or used by another task.
+ */
+uint8_t sched_task_create(uint8_t priority, SCHED_Task_t task);
+
+/**
+ * @brief Delete a task; the events posted to it are discarded.
+ * @param priority the task
+ */
+void sched_task_delete(uint8_t priority);
+
+/**
+ * @brief Post events to a task; the task will run with these events.
+ * @param priority the task
+ * @param events the events (bits) to post
+ * @note Can be called from interrupt handlers and from tasks.
+ */
+void sched_post(uint8_t priority, uint32_t events);
+
+/**
+ * @brief Run the ready task with the highest priority, if any.
+ * @return 1 if a task was run; 0 if no task was ready.
+ * @note Use this in your own main loop instead of sched_run, or in tests.
+ */
+uint8_t sched_dispatch(void);
+
+/**
+ * @brief Run the tasks forever; sleep when no task is ready.
+ * @note This function does not return.
+ */
+void sched_run(void);
+
+/**
+ * @brief Get the statistics of the scheduler.
+ * @param stats pointer to the structure to fill
+ */
+void sched_get_stats(SCHED_STATS* stats);
+
+/**
+ * @brief Get the statistics of a task.
+ * @param priority the task
+ * @param stats pointer to the structure to fill
+ */
+void sched_get_task_stats(uint8_t priority, SCHED_TASK_STATS* stats);
+
+/**
+ * @brief Reset all the statistics to zero.
+ */
+void sched_reset_stats(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+/* ----------- end of file -------------- */
+#endif /* MSF_SCHED_H */
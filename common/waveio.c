@@ -50,6 +50,7 @@ typedef enum wwaveio_channel_state
 	waveout_idle,
 	waveout_1st_half,	/* generating 1st half now */
 	waveout_2nd_half,
+	waveout_pwm,		/* generated by the timer in PWM mode; no ISR needed */
 
 	wavein_idle,
 	wavein_1st_edge,	/* 1st edge WAS detected */
@@ -69,6 +70,7 @@ typedef struct _waveio_channel_data
 {
 	uint32_t start;				/* time stamp for 1st detected edge (start of the period) */
 	uint16_t half_wave[2];		/* half-wave 1 and 2 parts */
+	uint16_t half_next[2];		/* new half-waves for the next period, see waveio_out_group_change */
 	waveio_channel_state status;	/* status of this channel/driver */
 
 } waveio_channel_data;
@@ -95,6 +97,123 @@ static volatile uint32_t gwaveio_input_channels;
  * It is used for timeout in waveio_in_pulse_wait() */
 static volatile uint32_t gwaveio_overflow_cnt[WAVEIO_MAX_DRIVERS];
 
+#if WAVEIO_USE_HW_PWM
+/* Period (in timer ticks) of the signal generated by each TPM timer in PWM mode.
+ * 0 means the timer is not in PWM mode (the outputs are generated in toggle mode
+ * with ISR). */
+static uint32_t gwaveio_pwm_period[WAVEIO_MAX_DRIVERS];
+
+/* Mask of the PWM channels which were stopped; the pin is disconnected
+ * in the ISR on the next channel match, when the output is low. */
+static volatile uint32_t gwaveio_pwm_stop_channels;
+#endif
+
+/* Number of counter ticks between overflows (MOD + 1) for each TPM timer.
+ * Used to compute the time stamps and intervals of the input edges. */
+static uint32_t gwaveio_counter_range[WAVEIO_MAX_DRIVERS];
+
+/* Masks of the waveio channels for each of the TPM timers and number of
+ * the first channel of each timer */
+static const uint32_t gwaveio_tpm_channels[WAVEIO_MAX_DRIVERS] =
+	{ WAVEIO_RANGE_0_5, WAVEIO_RANGE_6_7, WAVEIO_RANGE_8_9 };
+static const uint8_t gwaveio_tpm_first_channel[WAVEIO_MAX_DRIVERS] = { 0, 6, 8 };
+
+/* Pins of the channels as configured for the TPM drivers in msf_config.h;
+ * used to read the level of the input for the log */
+static const MCU_pin_t gwaveio_pins[WAVEIO_NUM_CHANNELS] = {
+	MSF_TPM0_CH0_PIN, MSF_TPM0_CH1_PIN, MSF_TPM0_CH2_PIN,
+	MSF_TPM0_CH3_PIN, MSF_TPM0_CH4_PIN, MSF_TPM0_CH5_PIN,
+	MSF_TPM1_CH0_PIN, MSF_TPM1_CH1_PIN,
+	MSF_TPM2_CH0_PIN, MSF_TPM2_CH1_PIN,
+};
+
+/* The log of edges for one input channel (ring buffer) */
+typedef struct _waveio_log_data
+{
+	WAVEIO_EDGE* buffer;	/* user-provided buffer */
+	uint16_t mask;			/* size of the buffer - 1 */
+	volatile uint16_t head;	/* next position to write; updated only by the ISR */
+	volatile uint16_t tail;	/* next position to read; updated only by waveio_in_log_read */
+	volatile uint16_t lost;	/* number of edges dropped because the buffer was full */
+	uint8_t level;			/* level of the pin after the last edge; toggled by the ISR */
+} waveio_log_data;
+
+static waveio_log_data gwaveio_log[WAVEIO_NUM_CHANNELS];
+
+/* Mask of input channels which record the edges into the log */
+static volatile uint32_t gwaveio_log_channels;
+
+/* Mask of channels which drive servos (see waveio_servo_attach) */
+static volatile uint32_t gwaveio_servo_channels;
+
+/* Margin in timer ticks for the start of a group of signals; the counters run
+ * while the channels are configured, so there is a margin for each channel too */
+#define	WAVEIO_GROUP_LEAD		(10)
+#define	WAVEIO_GROUP_LEAD_CHANNEL	(5)
+
+/* The skew of the timers measured by the last waveio_out_group_start, in ticks */
+static uint16_t gwaveio_group_skew;
+
+/* Mask of output channels started by waveio_out_group_start */
+static volatile uint32_t gwaveio_group_channels;
+
+/* Mask of output channels which use half_next from the start of the next pulse */
+static volatile uint32_t gwaveio_update_channels;
+
+/* Mask of input channels with pulse measurement in progress (see waveio_in_pulse_start) */
+static volatile uint32_t gwaveio_pulse_channels;
+
+/* Mask of the channels in gwaveio_pulse_channels which have a timeout */
+static volatile uint32_t gwaveio_pulse_timeouts;
+
+/* The callbacks for the pulse measurement */
+static WAVEIO_Pulse_Event_t gwaveio_pulse_cb[WAVEIO_NUM_CHANNELS];
+
+/* The overflow count of the channel's timer at which the pulse measurement times out */
+static uint32_t gwaveio_pulse_deadline[WAVEIO_NUM_CHANNELS];
+
+/* The result of the pulse measurement for waveio_in_pulse_wait */
+static volatile uint16_t gwaveio_pulse_result;
+static volatile bool gwaveio_pulse_done;
+
+#if WAVEIO_SERVO_GROUPS > 0
+/* The servo frame in timer ticks */
+#define	WAVEIO_SERVO_FRAME		((WAVEIO_SERVO_FRAME_US * WAVEIO_DIV_FACTOR) / WAVEIO_MULT_FACTOR)
+/* The shortest time between two compare matches in timer ticks; shorter pulses
+ * are extended so that the ISR cannot miss the next match */
+#define	WAVEIO_SERVO_MIN_GAP	(20)
+/* Value of the channel in free servo group */
+#define	WAVEIO_SERVO_FREE		(0xff)
+/* Value of waveio_servo_group.next which means the next match starts new frame */
+#define	WAVEIO_SERVO_NEW_FRAME	(0xff)
+
+/* The pulses of one frame of a servo group in the order of the slots;
+ * each pulse starts when the previous one ends */
+typedef struct _waveio_servo_schedule
+{
+	uint16_t len[WAVEIO_SERVOS_PER_CHANNEL];	/* pulse lengths in timer ticks */
+	uint8_t slot[WAVEIO_SERVOS_PER_CHANNEL];	/* the servo for each pulse */
+	uint8_t count;								/* number of pulses */
+	uint16_t gap;			/* time from the end of the last pulse to the next frame */
+} waveio_servo_schedule;
+
+/* Servos driven by one channel */
+typedef struct _waveio_servo_group
+{
+	MCU_pin_t pin[WAVEIO_SERVOS_PER_CHANNEL];		/* pins of the servos */
+	uint16_t pulse[WAVEIO_SERVOS_PER_CHANNEL];		/* requested pulse in timer ticks; 0 = no pulse */
+	waveio_servo_schedule sched[2];	/* the schedule used in this frame and the next one */
+	volatile uint8_t active;		/* index of the schedule used in this frame */
+	volatile uint8_t pending;		/* the other schedule is ready for the next frame */
+	uint8_t next;					/* the pulse to start on the next match; count = end of the last
+ 	 	 	 	 	 	 	 	 	 	 pulse, > count (WAVEIO_SERVO_NEW_FRAME) = start of frame */
+	uint8_t attached;				/* mask of the attached slots */
+	uint8_t channel;				/* waveio channel or WAVEIO_SERVO_FREE */
+} waveio_servo_group;
+
+static waveio_servo_group gwaveio_servo[WAVEIO_SERVO_GROUPS];
+#endif
+
 /* Function Prototype Section
 * Add prototypes for all functions called by this
 * module, with the exception of runtime routines.
@@ -104,9 +223,31 @@ static volatile uint32_t gwaveio_overflow_cnt[WAVEIO_MAX_DRIVERS];
 static void waveio_timer0_event(uint32_t event, uint32_t arg);
 static void waveio_timer1_event(uint32_t event, uint32_t arg);
 static void waveio_timer2_event(uint32_t event, uint32_t arg);
+static void waveio_timer0_channel(uint32_t tpm_channel, uint32_t value);
+static void waveio_timer1_channel(uint32_t tpm_channel, uint32_t value);
+static void waveio_timer2_channel(uint32_t tpm_channel, uint32_t value);
+static void waveio_on_channel_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, uint8_t channel, uint16_t cntval);
 static void waveio_on_out_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, uint8_t channel, uint16_t cntval);
 static void waveio_on_in_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, uint8_t channel, uint16_t cntval);
+static void waveio_on_log_event(uint8_t channel, uint16_t cntval);
+static void waveio_on_pulse_tof(uint8_t tpm_index);
+static void waveio_pulse_finish(uint8_t channel, uint16_t pulse);
+static void waveio_pulse_wait_done(WAVEIO_channel channel, uint16_t pulse);
+static uint32_t waveio_get_time(uint8_t tpm_index, uint16_t cntval);
+#if WAVEIO_SERVO_GROUPS > 0
+static waveio_servo_group* waveio_servo_find(uint8_t channel);
+static void waveio_servo_update(waveio_servo_group* g);
+static MSF_TPM_Channel_Event_t waveio_get_channel_handler(uint8_t tpm_index, bool servo);
+static void waveio_servo_event0(uint32_t tpm_channel, uint32_t value);
+static void waveio_servo_event1(uint32_t tpm_channel, uint32_t value);
+static void waveio_servo_event2(uint32_t tpm_channel, uint32_t value);
+static void waveio_on_servo_event(uint8_t tpm_index, uint8_t tpm_channel, uint8_t channel, uint16_t cntval);
+#endif
 static MSF_DRIVER_TPM* waveio_get_tpm_driver(uint8_t channel, uint8_t* out_channel);
+static uint8_t waveio_get_tpm_index(uint8_t channel);
+#if WAVEIO_USE_HW_PWM
+static void waveio_update_out_mode(uint8_t tpm_index);
+#endif
 
 /* Code section 
 * Add the code for this module.
@@ -124,13 +265,35 @@ void waveio_init(uint32_t channel_mask )
 	gwaveio_initialized_channels = 0;
 	gwaveio_active_channels	= 0;
 	gwaveio_input_channels = 0;
+	gwaveio_pulse_channels = 0;
+	gwaveio_pulse_timeouts = 0;
+	gwaveio_group_channels = 0;
+	gwaveio_group_skew = 0;
+	gwaveio_update_channels = 0;
+	gwaveio_log_channels = 0;
+	gwaveio_servo_channels = 0;
+#if WAVEIO_USE_HW_PWM
+	gwaveio_pwm_stop_channels = 0;
+#endif
+#if WAVEIO_SERVO_GROUPS > 0
+	for ( i=0; i<WAVEIO_SERVO_GROUPS; i++)
+		gwaveio_servo[i].channel = WAVEIO_SERVO_FREE;
+#endif
 	for ( i=0; i<WAVEIO_MAX_DRIVERS; i++)
+	{
 		gwaveio_overflow_cnt[i] = 0;
+		gwaveio_counter_range[i] = 0x10000;	// MOD = 0xffff set by TPM Initialize
+#if WAVEIO_USE_HW_PWM
+		gwaveio_pwm_period[i] = 0;
+#endif
+	}
 
 	// need to initialize TPM0?
 	if ( channel_mask & WAVEIO_RANGE_0_5 )
 	{
 		Driver_TPM0.Initialize(waveio_timer0_event);
+		for ( i=0; i<6; i++ )
+			Driver_TPM0.ChannelSetHandler(i, waveio_timer0_channel);
 		// The timer clock speed depends on F_CPU, see MSF_TPM_CLKSEL in msf_mkl25z.h
 		// and in waveio.h we set the WMSF_WAVEOUT_PRESCALER to obtain 1 MHz.
 		Driver_TPM0.Control(MSF_TPM_PRESCALER_SET | MSF_TPM_TOF_SIGNAL, WMSF_WAVEIO_PRESCALER);
@@ -141,6 +304,8 @@ void waveio_init(uint32_t channel_mask )
 	if ( channel_mask & WAVEIO_RANGE_6_7 )
 	{
 		Driver_TPM1.Initialize(waveio_timer1_event);
+		for ( i=0; i<2; i++ )
+			Driver_TPM1.ChannelSetHandler(i, waveio_timer1_channel);
 		Driver_TPM1.Control(MSF_TPM_PRESCALER_SET | MSF_TPM_TOF_SIGNAL, WMSF_WAVEIO_PRESCALER);
 		gwaveio_initialized_channels |= WAVEIO_RANGE_6_7;
 	}
@@ -148,6 +313,8 @@ void waveio_init(uint32_t channel_mask )
 	if ( channel_mask & WAVEIO_RANGE_8_9 )
 	{
 		Driver_TPM2.Initialize(waveio_timer2_event);
+		for ( i=0; i<2; i++ )
+			Driver_TPM2.ChannelSetHandler(i, waveio_timer2_channel);
 		Driver_TPM2.Control(MSF_TPM_PRESCALER_SET | MSF_TPM_TOF_SIGNAL, WMSF_WAVEIO_PRESCALER);
 		gwaveio_initialized_channels |= WAVEIO_RANGE_8_9;
 	}
@@ -163,6 +330,10 @@ void waveio_uninit(void)
 
 	gwaveio_active_channels	= 0;
 	gwaveio_input_channels = 0;
+	gwaveio_pulse_channels = 0;
+	gwaveio_pulse_timeouts = 0;
+	gwaveio_group_channels = 0;
+	gwaveio_update_channels = 0;
 
 	// need to initialize TPM0?
 	if ( gwaveio_initialized_channels & WAVEIO_RANGE_0_5 )
@@ -208,6 +379,12 @@ uint8_t waveio_in_attach(WAVEIO_channel iochannel)
 	 falling edge */
 	pdrv->ChannelSetMode(tpm_channel, InCapture_both_edges, MSF_TPM_PARAM_CHANNEL_EVENT);
 
+#if WAVEIO_USE_HW_PWM
+	/* Input capture needs the full counter range; if the outputs of this timer
+	 * use PWM mode, switch them back to toggle mode */
+	waveio_update_out_mode(waveio_get_tpm_index(channel));
+#endif
+
 	return WAVEIO_NO_ERROR;
 }
 
@@ -249,6 +426,11 @@ uint8_t waveio_out_start(WAVEIO_channel iochannel, uint16_t half1, uint16_t half
 
 	// stop generating the signal before updating values
 	gwaveio_active_channels &= ~(1 << channel);
+	// the channel is not part of a group anymore
+	gwaveio_group_channels &= ~(1 << channel);
+	MSF_ATOMIC_BEGIN();
+	gwaveio_update_channels &= ~(1 << channel);
+	MSF_ATOMIC_END();
 
 	// save the requested values to our buffer for updates in ISR
 	// note that we need to account for possible different speed of the timer for some
@@ -264,11 +446,18 @@ uint8_t waveio_out_start(WAVEIO_channel iochannel, uint16_t half1, uint16_t half
 	// Note that setting the channel mode itself will not change the pin state!
 	pdrv->ChannelSetMode(tpm_channel, OutCompare_toggle, MSF_TPM_PARAM_CHANNEL_EVENT);
 	// write the first half to timer register - we can write anything actually, just need the
-	// 1st interrupt to occur to start generating the signal
-	pdrv->ChannelWrite(tpm_channel, gwaveio_data[channel].half_wave[0]);
+	// 1st interrupt to occur to start generating the signal.
+	// The counter keeps running (it is not reset for the other channels), so the match is relative to it.
+	pdrv->ChannelWrite(tpm_channel, (uint16_t)(pdrv->CounterRead() + gwaveio_data[channel].half_wave[0]));
 
 	// enable updating the signal in timer interrupt
 	gwaveio_active_channels |= (1 << channel);
+
+#if WAVEIO_USE_HW_PWM
+	// If all the outputs of this timer have the same period now, use PWM mode
+	// for them; otherwise keep (or switch back to) the toggle mode.
+	waveio_update_out_mode(waveio_get_tpm_index(channel));
+#endif
 	return WAVEIO_NO_ERROR;
 
 }
@@ -293,6 +482,22 @@ uint8_t waveio_out_change(WAVEIO_channel iochannel, uint16_t half1) {
 	if (!(gwaveio_active_channels & (1 << channel)))
 		return WAVEIO_ERROR_INACTIVE_CHANNEL;
 
+#if WAVEIO_USE_HW_PWM
+	// In PWM mode just write the new pulse width; the timer uses the new
+	// value from the next period, so there is no glitch in the signal.
+	if ( gwaveio_data[channel].status == waveout_pwm )
+	{
+		period = gwaveio_data[channel].half_wave[0] + gwaveio_data[channel].half_wave[1];
+		half1 = ((uint32_t) half1 * WAVEIO_DIV_FACTOR) / WAVEIO_MULT_FACTOR;
+		if ( (half1 > period) || (half1 == 0) )
+			return MSF_ERROR_ARGUMENT;
+		gwaveio_data[channel].half_wave[0] = half1;
+		gwaveio_data[channel].half_wave[1] = period - half1;
+		pdrv->ChannelWrite(tpm_channel, half1);
+		return WAVEIO_NO_ERROR;
+	}
+#endif
+
 
 	// Wait for end of the pulse and then reset with a new period.
 	// waveout_1st_half means the ISR just used half_wave[0] and now is waiting for
@@ -340,6 +545,7 @@ uint8_t waveio_out_stop(WAVEIO_channel iochannel)
 	uint8_t tpm_channel;
 	MSF_DRIVER_TPM* drv;
 	uint8_t channel = (uint8_t)iochannel;
+	bool pwm = false;
 
 	drv = waveio_get_tpm_driver(channel, &tpm_channel);
 	if ( !drv )
@@ -352,16 +558,40 @@ uint8_t waveio_out_stop(WAVEIO_channel iochannel)
 	if ( (gwaveio_active_channels & (1 << channel))  == 0 )
 		return WAVEIO_ERROR_INACTIVE_CHANNEL;
 
+#if WAVEIO_USE_HW_PWM
+	pwm = (gwaveio_data[channel].status == waveout_pwm);
+#endif
+
 	// Howto be sure the pin is low when we stop?
 	// Version a) wait for the output pin to go low
 	// Version b) disconnect and again connect the channel?
 	// Version b) does not work - the disconnecting itself will not change the pin state.
 	// Ver. a): waiting
-	while (gwaveio_data[channel].status != waveout_2nd_half )
+	// In PWM mode the pin is disconnected later in the ISR, see below.
+	while ( !pwm && gwaveio_data[channel].status != waveout_2nd_half )
 		;
 
 
 	gwaveio_active_channels &= ~(1 << channel);
+	gwaveio_group_channels &= ~(1 << channel);
+	MSF_ATOMIC_BEGIN();
+	gwaveio_update_channels &= ~(1 << channel);
+	MSF_ATOMIC_END();
+
+#if WAVEIO_USE_HW_PWM
+	if ( pwm )
+	{
+		// Do not wait for the end of the period here; this function can be called
+		// from an ISR. Setting the mode again clears CnV (0% duty, the output stays low
+		// from the next period) and enables the channel event. On the next match the output
+		// is low and the ISR disconnects the pin, see waveio_on_channel_event.
+		MSF_ATOMIC_BEGIN();
+		gwaveio_pwm_stop_channels |= (1 << channel);
+		MSF_ATOMIC_END();
+		drv->ChannelSetMode(tpm_channel, PWM_edge_hightrue, MSF_TPM_PARAM_CHANNEL_EVENT);
+	}
+	else
+#endif
 	// We disconnect the pin so that it is forced low after the 1st match when connected again.
 	// The datasheet says "When a channel is initially configured to output compare mode,
 	// the channel output updates with its negated value (logic 0 for set/toggle/pulse high..."
@@ -378,6 +608,182 @@ uint8_t waveio_out_stop(WAVEIO_channel iochannel)
 	gwaveio_data[channel].half_wave[0] = 0;
 	gwaveio_data[channel].half_wave[1] = 0;
 
+#if WAVEIO_USE_HW_PWM
+	// The remaining channels of this timer may now have the same period
+	// (or there may be no output left on this timer)
+	waveio_update_out_mode(waveio_get_tpm_index(channel));
+#endif
+
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Start generating signals on a group of channels
+ */
+uint8_t waveio_out_group_start(const WAVEIO_GROUP_CHANNEL* group, uint8_t count, uint32_t flags)
+{
+	MSF_DRIVER_TPM* pdrv;
+	uint8_t i, channel, tpm_channel, tpm_index, first;
+	uint32_t mask = 0, tpms = 0, lead = 0, half2, busy;
+	uint16_t start, counter[WAVEIO_MAX_DRIVERS];
+
+	if ( group == null || count == 0 )
+		return MSF_ERROR_ARGUMENT;
+
+	// Check the channels and find the common start time. The first compare match only sets
+	// the pin low and the pulse starts half2 later, so the start is after the longest half2.
+	for ( i = 0; i < count; i++ )
+	{
+		channel = (uint8_t)group[i].channel;
+		if ( !waveio_get_tpm_driver(channel, &tpm_channel) )
+			return WAVEIO_ERROR_INVALID_CHANNEL;
+		if ( !(gwaveio_initialized_channels & (1 << channel)) )
+			return WAVEIO_ERROR_UNINITIALIZED_CHANNEL;
+		if ( group[i].half1 == 0 || group[i].half2 == 0 )
+			return MSF_ERROR_ARGUMENT;
+
+		half2 = ((uint32_t)group[i].half2 * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR;
+		if ( half2 > lead )
+			lead = half2;
+		mask |= (1UL << channel);
+		tpms |= (1UL << waveio_get_tpm_index(channel));
+	}
+	lead += WAVEIO_GROUP_LEAD + (uint32_t)count * WAVEIO_GROUP_LEAD_CHANNEL;
+
+	// The first match must be within one period of the counter
+	for ( i = 0; i < count; i++ )
+	{
+		if ( lead + ((uint32_t)group[i].phase * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR > 0xffff )
+			return MSF_ERROR_ARGUMENT;
+	}
+
+	// The counters keep running, so the group must not disturb the other channels
+	// of its timers: it cannot reset their counter nor switch them out of the PWM mode.
+	for ( tpm_index = 0; tpm_index < WAVEIO_MAX_DRIVERS; tpm_index++ )
+	{
+		if ( !(tpms & (1UL << tpm_index)) )
+			continue;
+		busy = (gwaveio_active_channels | gwaveio_input_channels | gwaveio_log_channels
+				| gwaveio_pulse_channels | gwaveio_servo_channels)
+				& gwaveio_tpm_channels[tpm_index] & ~mask;
+		if ( busy == 0 )
+			continue;
+		if ( flags & WAVEIO_GROUP_RESET_COUNTER )
+			return MSF_ERROR_ARGUMENT;
+#if WAVEIO_USE_HW_PWM
+		if ( gwaveio_pwm_period[tpm_index] != 0 )
+			return MSF_ERROR_ARGUMENT;
+#endif
+	}
+
+	gwaveio_active_channels &= ~mask;
+	gwaveio_input_channels &= ~mask;
+	gwaveio_log_channels &= ~mask;
+	gwaveio_group_channels |= mask;
+	MSF_ATOMIC_BEGIN();
+	gwaveio_pulse_channels &= ~mask;
+	gwaveio_pulse_timeouts &= ~mask;
+	gwaveio_update_channels &= ~mask;
+	MSF_ATOMIC_END();
+
+	// A timer with no other channels may leave the PWM mode and reset its counter
+	for ( tpm_index = 0; tpm_index < WAVEIO_MAX_DRIVERS; tpm_index++ )
+	{
+		if ( !(tpms & (1UL << tpm_index)) )
+			continue;
+#if WAVEIO_USE_HW_PWM
+		waveio_update_out_mode(tpm_index);
+#endif
+		if ( flags & WAVEIO_GROUP_RESET_COUNTER )
+		{
+			pdrv = waveio_get_tpm_driver(gwaveio_tpm_first_channel[tpm_index], &tpm_channel);
+			pdrv->Control(MSF_TPM_COUNTER_RESET, 0);
+		}
+	}
+
+	// Read the running counters of all the timers at once. They are read one after
+	// another, so they differ by the time of one CounterRead call (the skew); it is
+	// measured by reading the first counter again.
+	first = WAVEIO_MAX_DRIVERS;
+	MSF_ATOMIC_BEGIN();
+	for ( tpm_index = 0; tpm_index < WAVEIO_MAX_DRIVERS; tpm_index++ )
+	{
+		if ( !(tpms & (1UL << tpm_index)) )
+			continue;
+		pdrv = waveio_get_tpm_driver(gwaveio_tpm_first_channel[tpm_index], &tpm_channel);
+		counter[tpm_index] = (uint16_t)pdrv->CounterRead();
+		if ( first == WAVEIO_MAX_DRIVERS )
+			first = tpm_index;
+	}
+	pdrv = waveio_get_tpm_driver(gwaveio_tpm_first_channel[first], &tpm_channel);
+	gwaveio_group_skew = (uint16_t)((uint16_t)pdrv->CounterRead() - counter[first]);
+	MSF_ATOMIC_END();
+
+	for ( i = 0; i < count; i++ )
+	{
+		channel = (uint8_t)group[i].channel;
+		pdrv = waveio_get_tpm_driver(channel, &tpm_channel);
+		tpm_index = waveio_get_tpm_index(channel);
+		gwaveio_data[channel].half_wave[0] = (((uint32_t)group[i].half1 * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR);
+		gwaveio_data[channel].half_wave[1] = (((uint32_t)group[i].half2 * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR);
+		gwaveio_data[channel].status = waveout_idle;
+
+		// The pulse starts at lead + phase after the counter value read above;
+		// the first match, which sets the pin low, is half2 before it.
+		start = (uint16_t)(counter[tpm_index] + lead
+				+ (((uint32_t)group[i].phase * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR));
+		pdrv->ChannelSetMode(tpm_channel, OutCompare_toggle, MSF_TPM_PARAM_CHANNEL_EVENT);
+		pdrv->ChannelWrite(tpm_channel, (uint16_t)(start - gwaveio_data[channel].half_wave[1]));
+	}
+
+	gwaveio_active_channels |= mask;
+
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Return the skew of the timers measured by the last waveio_out_group_start
+ */
+uint16_t waveio_out_group_skew(void)
+{
+	return (uint16_t)(((uint32_t)gwaveio_group_skew * WAVEIO_MULT_FACTOR) / WAVEIO_DIV_FACTOR);
+}
+
+/*
+ * Change the signals of a group of channels
+ */
+uint8_t waveio_out_group_change(const WAVEIO_GROUP_CHANNEL* group, uint8_t count)
+{
+	uint8_t i, channel;
+	uint32_t mask = 0;
+
+	if ( group == null )
+		return MSF_ERROR_ARGUMENT;
+
+	for ( i = 0; i < count; i++ )
+	{
+		channel = (uint8_t)group[i].channel;
+		if ( channel >= WAVEIO_NUM_CHANNELS )
+			return WAVEIO_ERROR_INVALID_CHANNEL;
+		if ( !(gwaveio_active_channels & gwaveio_group_channels & (1 << channel)) )
+			return WAVEIO_ERROR_INACTIVE_CHANNEL;
+		if ( group[i].half1 == 0 || group[i].half2 == 0 )
+			return MSF_ERROR_ARGUMENT;
+		mask |= (1UL << channel);
+	}
+
+	// The ISR takes the new values at the start of the next pulse of each channel
+	MSF_ATOMIC_BEGIN();
+	for ( i = 0; i < count; i++ )
+	{
+		channel = (uint8_t)group[i].channel;
+		gwaveio_data[channel].half_next[0] = (((uint32_t)group[i].half1 * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR);
+		gwaveio_data[channel].half_next[1] = (((uint32_t)group[i].half2 * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR);
+	}
+	gwaveio_update_channels |= mask;
+	MSF_ATOMIC_END();
+
+	return WAVEIO_NO_ERROR;
 }
 
 /*
@@ -457,6 +863,8 @@ uint8_t waveio_in_stop(WAVEIO_channel iochannel)
 		return WAVEIO_ERROR_INVALID_CHANNEL;
 
 	gwaveio_active_channels &= ~(1 << channel);
+	gwaveio_log_channels &= ~(1 << channel);
+	waveio_in_pulse_cancel(iochannel);
 	// Reset the data for this channel
 	gwaveio_data[channel].status = wavein_idle;
 	gwaveio_data[channel].half_wave[0] = 0;
@@ -539,63 +947,81 @@ uint8_t waveio_in_read(WAVEIO_channel iochannel, uint16_t* pulseA, uint16_t* pul
  */
 uint16_t waveio_in_pulse_wait(WAVEIO_channel iochannel, uint32_t timeout )
 {
-	uint32_t endtime;
-	uint32_t curtime;
-	uint_fast8_t tpm_index = 0;
-	uint8_t channel = (uint8_t)iochannel;
+	gwaveio_pulse_done = false;
+	if ( waveio_in_pulse_start(iochannel, timeout, waveio_pulse_wait_done) != WAVEIO_NO_ERROR )
+		return 0;
 
-	if ( timeout > 0 )
-	{
-		// obtain the current overflow count for one of the active timers
-		if ( gwaveio_initialized_channels & WAVEIO_RANGE_0_5 )
-			tpm_index = 0;
-		else if ( gwaveio_initialized_channels & WAVEIO_RANGE_6_7 )
-			tpm_index = 1;
-		else
-			tpm_index = 2;
+	// the result is delivered by the timer ISR
+	while ( !gwaveio_pulse_done )
+		;
 
-		curtime = gwaveio_overflow_cnt[tpm_index];
+	return gwaveio_pulse_result;
+}
 
-		if ( timeout <= WAVEIO_OVERFLOW_UNITMS)
-			endtime = curtime + 1;
-		else
-		{
-			endtime = curtime + (timeout / WAVEIO_OVERFLOW_UNITMS) + 1;	// how many overflows to wait
-			// add 1 so that, for example timeout 100 results in 2 overflows = 132 ms rather than
-			// 1 overflow = 66 ms. (for WAVEIN_OVERFLOW_UNITMS = 66).
-			if ( endtime < curtime )	// overflow of the gwavein_overflow_cnt
-			{
-				// just reset the counter of overflows
-				gwaveio_overflow_cnt[tpm_index] = 0;
-				endtime = (timeout / WAVEIO_OVERFLOW_UNITMS) + 1;
-			}
+/*
+ * Start measuring pulse on given input channel
+ */
+uint8_t waveio_in_pulse_start(WAVEIO_channel iochannel, uint32_t timeout, WAVEIO_Pulse_Event_t callback)
+{
+	uint8_t channel = (uint8_t)iochannel;
+	uint8_t tpm_index;
+	uint32_t mask = (1UL << channel);
 
+	if ( channel >= WAVEIO_NUM_CHANNELS )
+		return WAVEIO_ERROR_INVALID_CHANNEL;
 
-		}
-	}
-	else
-		endtime = 0;
+	if ( !(gwaveio_initialized_channels & mask) )
+		return WAVEIO_ERROR_UNINITIALIZED_CHANNEL;
+
+	if ( !(gwaveio_input_channels & mask) )
+		return WAVEIO_ERROR_INACTIVE_CHANNEL;
+
+	if ( callback == null )
+		return MSF_ERROR_ARGUMENT;
 
 	// disable the channel (synchronization with ISR)
-	gwaveio_active_channels &= ~(1 << channel);
+	gwaveio_active_channels &= ~mask;
 	// Reset the data for this channel
 	gwaveio_data[channel].status = wavein_idle;
 	gwaveio_data[channel].half_wave[0] = 0;
 	gwaveio_data[channel].half_wave[1] = 0;
+
+	// The timeout is the number of timer overflows to wait; add 1 so that, for example
+	// timeout 100 results in 2 overflows = 132 ms rather than 1 overflow = 66 ms
+	// (for WAVEIO_OVERFLOW_UNITMS = 66).
+	tpm_index = waveio_get_tpm_index(channel);
+	gwaveio_pulse_cb[channel] = callback;
+
+	// the masks are also changed by the ISR
+	MSF_ATOMIC_BEGIN();
+	gwaveio_pulse_deadline[channel] = gwaveio_overflow_cnt[tpm_index] + (timeout / WAVEIO_OVERFLOW_UNITMS) + 1;
+	gwaveio_pulse_channels |= mask;
+	if ( timeout > 0 )
+		gwaveio_pulse_timeouts |= mask;
+	else
+		gwaveio_pulse_timeouts &= ~mask;
+	MSF_ATOMIC_END();
+
 	// enable the channel
-	gwaveio_active_channels |= (1 << channel);
-	// wait for 2 edges
-	while ( gwaveio_data[channel].status != wavein_2nd_edge )
-	{
-		if ( (endtime > 0) && (gwaveio_overflow_cnt[tpm_index] >= endtime) )
-			return 0;	// timeout occurred
-	}
+	gwaveio_active_channels |= mask;
+	return WAVEIO_NO_ERROR;
+}
 
-	// Account for different clock than 1 MHz
-	// using endtime for temporary storage!
-	endtime = (((uint32_t)gwaveio_data[channel].half_wave[0] * WAVEIO_MULT_FACTOR)/WAVEIO_DIV_FACTOR);
+/*
+ * Cancel the pulse measurement
+ */
+uint8_t waveio_in_pulse_cancel(WAVEIO_channel iochannel)
+{
+	uint8_t channel = (uint8_t)iochannel;
 
-	return (uint16_t)endtime;
+	if ( channel >= WAVEIO_NUM_CHANNELS )
+		return WAVEIO_ERROR_INVALID_CHANNEL;
+
+	MSF_ATOMIC_BEGIN();
+	gwaveio_pulse_channels &= ~(1UL << channel);
+	gwaveio_pulse_timeouts &= ~(1UL << channel);
+	MSF_ATOMIC_END();
+	return WAVEIO_NO_ERROR;
 }
 
 /*
@@ -630,6 +1056,263 @@ uint16_t waveio_in_servo_read_us(WAVEIO_channel iochannel)
 }
 
 
+#if WAVEIO_SERVO_GROUPS > 0
+/*
+ * Attach servo to given channel
+ */
+uint8_t waveio_servo_attach(WAVEIO_channel iochannel, uint8_t slot, MCU_pin_t pin)
+{
+	uint8_t tpm_channel, tpm_index;
+	MSF_DRIVER_TPM* pdrv;
+	waveio_servo_group* g;
+	uint8_t channel = (uint8_t)iochannel;
+
+	pdrv = waveio_get_tpm_driver(channel, &tpm_channel);
+	if ( !pdrv )
+		return WAVEIO_ERROR_INVALID_CHANNEL;
+
+	if ( !(gwaveio_initialized_channels & (1 << channel)) )
+		return WAVEIO_ERROR_UNINITIALIZED_CHANNEL;
+
+	if ( slot >= WAVEIO_SERVOS_PER_CHANNEL )
+		return MSF_ERROR_ARGUMENT;
+
+	g = waveio_servo_find(channel);
+	if ( !g )
+	{
+		// The first servo on this channel; take the channel over
+		g = waveio_servo_find(WAVEIO_SERVO_FREE);
+		if ( !g )
+			return WAVEIO_ERROR_NO_SERVO_GROUP;
+
+		g->attached = 0;
+		g->active = 0;
+		g->pending = 0;
+		g->next = WAVEIO_SERVO_NEW_FRAME;
+		g->sched[0].count = 0;
+		g->sched[0].gap = WAVEIO_SERVO_FRAME;
+		g->channel = channel;
+
+		gwaveio_active_channels &= ~(1 << channel);
+		gwaveio_input_channels &= ~(1 << channel);
+		gwaveio_log_channels &= ~(1 << channel);
+		gwaveio_servo_channels |= (1 << channel);
+
+		tpm_index = waveio_get_tpm_index(channel);
+#if WAVEIO_USE_HW_PWM
+		// The servo timing needs the full counter range
+		waveio_update_out_mode(tpm_index);
+#endif
+		// The first interrupt starts the first frame
+		pdrv->ChannelSetHandler(tpm_channel, waveio_get_channel_handler(tpm_index, true));
+		pdrv->ChannelSetMode(tpm_channel, SWcompare, MSF_TPM_PARAM_CHANNEL_EVENT);
+		pdrv->ChannelWrite(tpm_channel, 0);
+	}
+	else if ( g->attached & (1 << slot) )
+	{
+		return MSF_ERROR_ARGUMENT;	// the slot is used
+	}
+
+	msf_pin_direction(pin, output);
+	msf_pin_write(pin, false);
+	g->pin[slot] = pin;
+	g->pulse[slot] = 0;
+	g->attached |= (1 << slot);
+
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Detach servo from given channel
+ */
+uint8_t waveio_servo_detach(WAVEIO_channel iochannel, uint8_t slot)
+{
+	uint8_t tpm_channel, tpm_index;
+	MSF_DRIVER_TPM* pdrv;
+	waveio_servo_group* g;
+	uint8_t channel = (uint8_t)iochannel;
+
+	pdrv = waveio_get_tpm_driver(channel, &tpm_channel);
+	g = waveio_servo_find(channel);
+	if ( !pdrv || !g || slot >= WAVEIO_SERVOS_PER_CHANNEL || !(g->attached & (1 << slot)) )
+		return MSF_ERROR_ARGUMENT;
+
+	g->pulse[slot] = 0;
+	g->attached &= ~(1 << slot);
+
+	if ( g->attached != 0 )
+	{
+		waveio_servo_update(g);
+		return WAVEIO_NO_ERROR;
+	}
+
+	// The last servo; give the channel back to waveio
+	tpm_index = waveio_get_tpm_index(channel);
+	pdrv->ChannelSetMode(tpm_channel, Disabled, 0);
+	pdrv->ChannelSetHandler(tpm_channel, waveio_get_channel_handler(tpm_index, false));
+	msf_pin_write(g->pin[slot], false);
+	g->channel = WAVEIO_SERVO_FREE;
+	gwaveio_servo_channels &= ~(1 << channel);
+#if WAVEIO_USE_HW_PWM
+	waveio_update_out_mode(tpm_index);
+#endif
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Set position of servo in microseconds
+ */
+uint8_t waveio_servo_write_us(WAVEIO_channel iochannel, uint8_t slot, uint16_t us)
+{
+	waveio_servo_group* g = waveio_servo_find((uint8_t)iochannel);
+
+	if ( !g || slot >= WAVEIO_SERVOS_PER_CHANNEL || !(g->attached & (1 << slot))
+			|| us > WAVEIO_SERVO_MAX_US )
+		return MSF_ERROR_ARGUMENT;
+
+	g->pulse[slot] = (uint16_t)(((uint32_t)us * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR);
+	waveio_servo_update(g);
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Set position of servo in degrees
+ */
+uint8_t waveio_servo_write(WAVEIO_channel iochannel, uint8_t slot, uint8_t angle)
+{
+	if (angle > 180)
+		return MSF_ERROR_ARGUMENT;
+	// the same conversion as in waveio_out_servo: 0 = 1000 us; 180 = 2000 us
+	return waveio_servo_write_us(iochannel, slot, (uint16_t)(((uint32_t)angle * 555) / 100 + 1000));
+}
+
+/*
+ * Set positions of several servos at once
+ */
+uint8_t waveio_servo_write_all_us(WAVEIO_channel iochannel, const uint16_t* us, uint8_t count)
+{
+	uint8_t slot;
+	waveio_servo_group* g = waveio_servo_find((uint8_t)iochannel);
+
+	if ( !g || count > WAVEIO_SERVOS_PER_CHANNEL )
+		return MSF_ERROR_ARGUMENT;
+
+	for ( slot = 0; slot < count; slot++ )
+	{
+		if ( us[slot] > WAVEIO_SERVO_MAX_US )
+			return MSF_ERROR_ARGUMENT;
+	}
+
+	for ( slot = 0; slot < count; slot++ )
+	{
+		if ( g->attached & (1 << slot) )
+			g->pulse[slot] = (uint16_t)(((uint32_t)us[slot] * WAVEIO_DIV_FACTOR)/WAVEIO_MULT_FACTOR);
+	}
+
+	waveio_servo_update(g);
+	return WAVEIO_NO_ERROR;
+}
+#endif	/* WAVEIO_SERVO_GROUPS > 0 */
+
+/*
+ * Start recording the edges on given input channel
+ */
+uint8_t waveio_in_log_start(WAVEIO_channel iochannel, WAVEIO_EDGE* buffer, uint16_t size)
+{
+	uint8_t channel = (uint8_t)iochannel;
+
+	if ( channel >= WAVEIO_NUM_CHANNELS )
+		return WAVEIO_ERROR_INVALID_CHANNEL;
+
+	if ( !(gwaveio_initialized_channels & (1 << channel)) )
+		return WAVEIO_ERROR_UNINITIALIZED_CHANNEL;
+
+	// The channel must be attached as input; size must be power of 2
+	if ( !(gwaveio_input_channels & (1 << channel)) || buffer == null
+			|| size < 2 || size > 32768 || (size & (size - 1)) != 0 )
+		return MSF_ERROR_ARGUMENT;
+
+	// disable the channel (synchronization with ISR)
+	gwaveio_active_channels &= ~(1 << channel);
+	gwaveio_log[channel].buffer = buffer;
+	gwaveio_log[channel].mask = size - 1;
+	gwaveio_log[channel].head = 0;
+	gwaveio_log[channel].tail = 0;
+	gwaveio_log[channel].lost = 0;
+	// the input captures both edges, so the level toggles on each edge from this one
+	gwaveio_log[channel].level = (uint8_t)msf_pin_read(gwaveio_pins[channel]);
+	gwaveio_log_channels |= (1 << channel);
+	gwaveio_active_channels |= (1 << channel);
+
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Stop recording the edges on given input channel
+ */
+uint8_t waveio_in_log_stop(WAVEIO_channel iochannel)
+{
+	uint8_t channel = (uint8_t)iochannel;
+
+	if ( channel >= WAVEIO_NUM_CHANNELS )
+		return WAVEIO_ERROR_INVALID_CHANNEL;
+
+	gwaveio_active_channels &= ~(1 << channel);
+	gwaveio_log_channels &= ~(1 << channel);
+	return WAVEIO_NO_ERROR;
+}
+
+/*
+ * Read the recorded edges
+ * Only the ISR writes the head and only this function writes the tail, so no
+ * locking is needed.
+ */
+uint16_t waveio_in_log_read(WAVEIO_channel iochannel, WAVEIO_EDGE* edges, uint16_t max)
+{
+	uint16_t n, tail, count;
+	waveio_log_data* log;
+
+	if ( (uint8_t)iochannel >= WAVEIO_NUM_CHANNELS )
+		return 0;
+
+	log = &gwaveio_log[iochannel];
+	if ( log->buffer == null )
+		return 0;
+
+	tail = log->tail;
+	count = (uint16_t)(log->head - tail);
+	if ( count > max )
+		count = max;
+
+	for ( n = 0; n < count; n++ )
+	{
+		edges[n] = log->buffer[tail & log->mask];
+		tail++;
+	}
+
+	log->tail = tail;
+	return count;
+}
+
+/*
+ * Get and reset the number of lost edges
+ */
+uint16_t waveio_in_log_lost(WAVEIO_channel iochannel)
+{
+	uint16_t lost;
+
+	if ( (uint8_t)iochannel >= WAVEIO_NUM_CHANNELS )
+		return 0;
+
+	MSF_ATOMIC_BEGIN();
+	lost = gwaveio_log[iochannel].lost;
+	gwaveio_log[iochannel].lost = 0;
+	MSF_ATOMIC_END();
+
+	return lost;
+}
+
+
 /*
  * --------------------------------------------
  * Internal functions
@@ -668,150 +1351,192 @@ static MSF_DRIVER_TPM* waveio_get_tpm_driver(uint8_t channel, uint8_t* out_chann
 	return null;
 }
 
-
-
-/* The code is in #if because if the driver TPMx does not exists (user does not
- * need to use it, this would generate compile errors. */
-#if (MSF_DRIVER_TPM0)
-/* Handler for the timer low-level driver events */
-static void waveio_timer0_event(uint32_t event, uint32_t arg)
+/* Return the index of the TPM timer (0 for TPM0 etc.) for given channel */
+static uint8_t waveio_get_tpm_index(uint8_t channel)
 {
-	switch ( event )
-	{
-	// This event is signaled when timer TPM0 counter overflows
-	case MSF_TPM_EVENT_TOF:
-		gwaveio_overflow_cnt[0]++;
-		break;
+	if ( channel <= 5 )
+		return 0;
+	else if ( channel <= 7 )
+		return 1;
+	else
+		return 2;
+}
 
-	case MSF_TPM_EVENT_CH0:
-		if ( gwaveio_active_channels & (1 << 0) )
-		{
-			if ( gwaveio_input_channels & (1 << 0) )
-				waveio_on_in_event(&Driver_TPM0, 0, 0, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM0, 0, 0, (uint16_t)arg);
-		}
-		break;
+#if WAVEIO_USE_HW_PWM
+/* Select the mode for the output channels of given timer.
+ * If all the output channels of the timer have the same period and no channel
+ * of the timer is used as input, the timer is set to edge-aligned PWM mode with
+ * MOD = period; the signal is then generated without any interrupts.
+ * Otherwise the outputs are generated in toggle mode with ISR.
+ * The output channels of the timer are re-configured which disrupts their
+ * signal for about one period, the same as when starting a new channel. */
+static void waveio_update_out_mode(uint8_t tpm_index)
+{
+	MSF_DRIVER_TPM* pdrv;
+	uint32_t outputs, period, p;
+	uint8_t channel, tpm_channel;
+	uint8_t first = gwaveio_tpm_first_channel[tpm_index];
 
-	case MSF_TPM_EVENT_CH1:
-		if ( gwaveio_active_channels & (1 << 1) )
-		{
-			if ( gwaveio_input_channels & (1 << 1) )
-				waveio_on_in_event(&Driver_TPM0, 1, 1, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM0, 1, 1, (uint16_t)arg);
-		}
-		break;
+	pdrv = waveio_get_tpm_driver(first, &tpm_channel);
+	if ( !pdrv )
+		return;
 
-	case MSF_TPM_EVENT_CH2:
-		if ( gwaveio_active_channels & (1 << 2) )
+	outputs = gwaveio_active_channels & gwaveio_tpm_channels[tpm_index] & ~gwaveio_input_channels;
+	period = 0;
+	if ( outputs != 0 && ((gwaveio_input_channels | gwaveio_servo_channels | gwaveio_group_channels)
+			& gwaveio_tpm_channels[tpm_index]) == 0 )
+	{
+		for ( channel = first; channel < WAVEIO_NUM_CHANNELS; channel++ )
 		{
-			if ( gwaveio_input_channels & (1 << 2) )
-				waveio_on_in_event(&Driver_TPM0, 2, 2, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM0, 2, 2, (uint16_t)arg);
+			if ( (outputs & (1UL << channel)) == 0 )
+				continue;
+			p = (uint32_t)gwaveio_data[channel].half_wave[0] + gwaveio_data[channel].half_wave[1];
+			if ( period == 0 )
+				period = p;
+			else if ( p != period )
+			{
+				period = 0;		// different periods; cannot use PWM
+				break;
+			}
 		}
-		break;
+		// The MOD register is 16-bit (and so is the period in waveio_out_change)
+		if ( period > 0xffff )
+			period = 0;
+	}
 
-	case MSF_TPM_EVENT_CH3:
-		if ( gwaveio_active_channels & (1 << 3) )
+	if ( period != 0 )
+	{
+		// Use PWM mode; no interrupts needed, not even for the overflow
+		pdrv->Control(MSF_TPM_TOF_NO_SIGNAL | MSF_TPM_MOD_VALUE, period - 1);
+		gwaveio_counter_range[tpm_index] = period;
+		for ( channel = first; channel < WAVEIO_NUM_CHANNELS; channel++ )
 		{
-			if ( gwaveio_input_channels & (1 << 3) )
-				waveio_on_in_event(&Driver_TPM0, 3, 3, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM0, 3, 3, (uint16_t)arg);
+			if ( (outputs & (1UL << channel)) == 0 )
+				continue;
+			waveio_get_tpm_driver(channel, &tpm_channel);
+			gwaveio_data[channel].status = waveout_pwm;
+			pdrv->ChannelSetMode(tpm_channel, PWM_edge_hightrue, 0);
+			pdrv->ChannelWrite(tpm_channel, gwaveio_data[channel].half_wave[0]);
 		}
-		break;
-
-	case MSF_TPM_EVENT_CH4:
-		if ( gwaveio_active_channels & (1 << 4) )
+		gwaveio_pwm_period[tpm_index] = period;
+	}
+	else if ( gwaveio_pwm_period[tpm_index] != 0 )
+	{
+		// Switch back to the toggle mode with full counter range
+		gwaveio_pwm_period[tpm_index] = 0;
+		pdrv->Control(MSF_TPM_TOF_SIGNAL | MSF_TPM_MOD_VALUE, 0xffff);
+		gwaveio_counter_range[tpm_index] = 0x10000;
+		for ( channel = first; channel < WAVEIO_NUM_CHANNELS; channel++ )
 		{
-			if ( gwaveio_input_channels & (1 << 4) )
-				waveio_on_in_event(&Driver_TPM0, 4, 4, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM0, 4, 4, (uint16_t)arg);
+			if ( (outputs & (1UL << channel)) == 0 )
+				continue;
+			waveio_get_tpm_driver(channel, &tpm_channel);
+			gwaveio_data[channel].status = waveout_idle;
+			pdrv->ChannelSetMode(tpm_channel, OutCompare_toggle, MSF_TPM_PARAM_CHANNEL_EVENT);
+			pdrv->ChannelWrite(tpm_channel, gwaveio_data[channel].half_wave[0]);
 		}
+	}
+}
+#endif	/* WAVEIO_USE_HW_PWM */
 
-		break;
-
-	case MSF_TPM_EVENT_CH5:
-		if ( gwaveio_active_channels & (1 << 5) )
-		{
-			if ( gwaveio_input_channels & (1 << 5) )
-				waveio_on_in_event(&Driver_TPM0, 5, 5, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM0, 5, 5, (uint16_t)arg);
-		}
 
-		break;
 
+/* The code is in #if because if the driver TPMx does not exists (user does not
+ * need to use it, this would generate compile errors. */
+#if (MSF_DRIVER_TPM0)
+/* Handler for the timer low-level driver events.
+ * Only TOF comes here; the channel events are reported directly to
+ * waveio_timer0_channel (see ChannelSetHandler in waveio_init). */
+static void waveio_timer0_event(uint32_t event, uint32_t arg)
+{
+	// This event is signaled when timer TPM0 counter overflows
+	if ( event == MSF_TPM_EVENT_TOF )
+	{
+		gwaveio_overflow_cnt[0]++;
+		if ( gwaveio_pulse_timeouts )
+			waveio_on_pulse_tof(0);
 	}
+}
 
+/* Handler for the channel events of TPM0; waveio channels 0 - 5 */
+static void waveio_timer0_channel(uint32_t tpm_channel, uint32_t value)
+{
+	waveio_on_channel_event(&Driver_TPM0, tpm_channel, tpm_channel, (uint16_t)value);
 }
 #endif	/* MSF_DRIVER_TPM0 */
 
 #if (MSF_DRIVER_TPM1)
 static void waveio_timer1_event(uint32_t event, uint32_t arg)
 {
-	switch ( event )
+	if ( event == MSF_TPM_EVENT_TOF )
 	{
-	case MSF_TPM_EVENT_TOF:
 		gwaveio_overflow_cnt[1]++;
-		break;
-
-	case MSF_TPM_EVENT_CH0:
-		if ( gwaveio_active_channels & (1 << 6) )
-		{
-			if ( gwaveio_input_channels & (1 << 6) )
-				waveio_on_in_event(&Driver_TPM0, 0, 6, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM1, 0, 6, (uint16_t)arg);
-		}
-		break;
-
-	case MSF_TPM_EVENT_CH1:
-		if ( gwaveio_active_channels & (1 << 7) )
-		{
-			if ( gwaveio_input_channels & (1 << 7) )
-				waveio_on_in_event(&Driver_TPM0, 1, 7, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM1, 1, 7, (uint16_t)arg);
-		}
-		break;
+		if ( gwaveio_pulse_timeouts )
+			waveio_on_pulse_tof(1);
 	}
 }
+
+/* Handler for the channel events of TPM1; waveio channels 6 - 7 */
+static void waveio_timer1_channel(uint32_t tpm_channel, uint32_t value)
+{
+	waveio_on_channel_event(&Driver_TPM1, tpm_channel, tpm_channel + 6, (uint16_t)value);
+}
 #endif	/* MSF_DRIVER_TPM1 */
 
 #if (MSF_DRIVER_TPM2)
 static void waveio_timer2_event(uint32_t event, uint32_t arg)
 {
-	switch ( event )
+	if ( event == MSF_TPM_EVENT_TOF )
 	{
-	case MSF_TPM_EVENT_TOF:
 		gwaveio_overflow_cnt[2]++;
-		break;
+		if ( gwaveio_pulse_timeouts )
+			waveio_on_pulse_tof(2);
+	}
+}
 
-	case MSF_TPM_EVENT_CH0:
-		if ( gwaveio_active_channels & (1 << 8) )
+/* Handler for the channel events of TPM2; waveio channels 8 - 9 */
+static void waveio_timer2_channel(uint32_t tpm_channel, uint32_t value)
+{
+	waveio_on_channel_event(&Driver_TPM2, tpm_channel, tpm_channel + 8, (uint16_t)value);
+}
+#endif /* MSF_DRIVER_TPM2 */
+
+/* Called from the channel handlers to pass the event to input or output processing
+ * @param tpm_channel the channel in the TPM driver
+ * @param channel the channel in waveout driver
+ * @param cntval the value of the channel register (CnV).
+ * */
+static void waveio_on_channel_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, uint8_t channel, uint16_t cntval)
+{
+	uint32_t mask = (1UL << channel);
+
+#if WAVEIO_USE_HW_PWM
+	// Stopped PWM output: the match cleared the output, so it is safe to disconnect now.
+	// If the channel was started again meanwhile, it is configured already; just forget the stop.
+	if ( gwaveio_pwm_stop_channels & mask )
+	{
+		gwaveio_pwm_stop_channels &= ~mask;
+		if ( (gwaveio_active_channels & mask) == 0 )
 		{
-			if ( gwaveio_input_channels & (1 << 8) )
-				waveio_on_in_event(&Driver_TPM0, 0, 8, (uint16_t)arg);
-			else
-				waveio_on_out_event(&Driver_TPM2, 0, 8, (uint16_t)arg);
+			pdriver->ChannelSetMode(tpm_channel, Disabled, 0);
+			return;
 		}
-		break;
+	}
+#endif
 
-	case MSF_TPM_EVENT_CH1:
-		if ( gwaveio_active_channels & (1 << 9) )
+	if ( gwaveio_active_channels & mask )
+	{
+		if ( gwaveio_input_channels & mask )
 		{
-			if ( gwaveio_input_channels & (1 << 9) )
-				waveio_on_in_event(&Driver_TPM0, 1, 9, (uint16_t)arg);
+			if ( gwaveio_log_channels & mask )
+				waveio_on_log_event(channel, cntval);
 			else
-				waveio_on_out_event(&Driver_TPM2, 1, 9, (uint16_t)arg);
+				waveio_on_in_event(pdriver, tpm_channel, channel, cntval);
 		}
+		else
+			waveio_on_out_event(pdriver, tpm_channel, channel, cntval);
 	}
 }
-#endif /* MSF_DRIVER_TPM2 */
 
 
 /* Called from timer event handler to process the event.
@@ -843,6 +1568,14 @@ static void waveio_on_out_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, ui
 		break;
 
 	case waveout_2nd_half:	// match after 2nd half; now start the 1st half again
+		if ( gwaveio_update_channels & (1UL << channel) )
+		{
+			// New values from waveio_out_group_change; used from the start of the pulse
+			// so that the start of the period (the phase) does not move.
+			gwaveio_data[channel].half_wave[0] = gwaveio_data[channel].half_next[0];
+			gwaveio_data[channel].half_wave[1] = gwaveio_data[channel].half_next[1];
+			gwaveio_update_channels &= ~(1UL << channel);
+		}
 		// calculate the value when next match should occur
 		next_match = cntval + gwaveio_data[channel].half_wave[0];
 		pdriver->ChannelWrite(tpm_channel, next_match);
@@ -861,35 +1594,277 @@ static void waveio_on_out_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, ui
  * param cntval the value of the timer counter (timestamp for the edge on input) */
 static void waveio_on_in_event(MSF_DRIVER_TPM* pdriver, uint8_t tpm_channel, uint8_t channel, uint16_t cntval)
 {
+	uint32_t now, interval, us;
+
+	// The time stamps include the overflow count, so the interval is simple
+	// difference, without branches for the counter wrap-around.
+	now = waveio_get_time(waveio_get_tpm_index(channel), cntval);
+	interval = now - gwaveio_data[channel].start;
+	// Intervals longer than 16 bits (more than one overflow period) are reported as 0xffff
+	interval = (interval | ((uint32_t)0 - (uint32_t)((interval >> 16) != 0))) & 0xffff;
+	gwaveio_data[channel].start = now;
+
 	switch( gwaveio_data[channel].status )
 	{
 	case wavein_idle:	// 1st edge detected, just save the time stamp
-		gwaveio_data[channel].start = cntval;
 		gwaveio_data[channel].status = wavein_1st_edge;
 		break;
 
-	case wavein_1st_edge:	// 2nd edge detected, calculate the length of 1st wave part
-		if ( gwaveio_data[channel].start > cntval )
-			gwaveio_data[channel].half_wave[0] = 0xffff - gwaveio_data[channel].start + cntval;
-		else
-			gwaveio_data[channel].half_wave[0] = cntval - gwaveio_data[channel].start;
-
-		gwaveio_data[channel].start = cntval;
+	case wavein_1st_edge:	// 2nd edge detected, the length of 1st wave part
+		gwaveio_data[channel].half_wave[0] = (uint16_t)interval;
 		gwaveio_data[channel].status = wavein_2nd_edge;
+		if ( gwaveio_pulse_channels & (1UL << channel) )
+		{
+			// saturate after the scaling too; the pulse in us can be longer than 16 bits
+			us = (interval * WAVEIO_MULT_FACTOR)/WAVEIO_DIV_FACTOR;
+			us |= (uint32_t)0 - (uint32_t)((us >> 16) != 0);
+			waveio_pulse_finish(channel, (uint16_t)us);
+		}
 		break;
 
 	case wavein_2nd_edge:	// 3rd edge detected: it is the end of part 2 and start of next period part 1
-		if ( gwaveio_data[channel].start > cntval )
-			gwaveio_data[channel].half_wave[1] = 0xffff - gwaveio_data[channel].start + cntval;
-		else
-			gwaveio_data[channel].half_wave[1] = cntval - gwaveio_data[channel].start;
-
-		gwaveio_data[channel].start = cntval;
+		gwaveio_data[channel].half_wave[1] = (uint16_t)interval;
 		gwaveio_data[channel].status = wavein_1st_edge;
 		break;
 	}
 
 }
 
+/*
+ * Store the edge into the log of the channel.
+ * param channel waveio channel
+ * param cntval the captured value (CnV) */
+static void waveio_on_log_event(uint8_t channel, uint16_t cntval)
+{
+	waveio_log_data* log = &gwaveio_log[channel];
+	uint16_t head = log->head;
+
+	log->level ^= 1;	// also for the dropped edges, so that the next levels are right
+	if ( (uint16_t)(head - log->tail) > log->mask )
+	{
+		log->lost++;	// buffer is full
+		return;
+	}
+
+	log->buffer[head & log->mask].time = waveio_get_time(waveio_get_tpm_index(channel), cntval);
+	log->buffer[head & log->mask].level = log->level;
+	log->head = head + 1;
+}
+
+/*
+ * Check the timeouts of the pulse measurements on the channels of given timer.
+ * Called from the TOF event handler.
+ * param tpm_index index of the TPM timer */
+static void waveio_on_pulse_tof(uint8_t tpm_index)
+{
+	uint32_t pending = gwaveio_pulse_timeouts & gwaveio_tpm_channels[tpm_index];
+	uint8_t channel;
+
+	for ( channel = gwaveio_tpm_first_channel[tpm_index]; pending; channel++ )
+	{
+		if ( pending & (1UL << channel) )
+		{
+			pending &= ~(1UL << channel);
+			// signed difference handles the wrap-around of the overflow counter
+			if ( (int32_t)(gwaveio_overflow_cnt[tpm_index] - gwaveio_pulse_deadline[channel]) >= 0 )
+				waveio_pulse_finish(channel, 0);
+		}
+	}
+}
+
+/*
+ * End the pulse measurement on given channel and report the result to the user.
+ * Called from the TPM ISR.
+ * param channel waveio channel
+ * param pulse the length of the pulse in us; 0 for timeout */
+static void waveio_pulse_finish(uint8_t channel, uint16_t pulse)
+{
+	gwaveio_pulse_channels &= ~(1UL << channel);
+	gwaveio_pulse_timeouts &= ~(1UL << channel);
+	gwaveio_pulse_cb[channel]((WAVEIO_channel)channel, pulse);
+}
+
+/* The callback used by the blocking waveio_in_pulse_wait */
+static void waveio_pulse_wait_done(WAVEIO_channel channel, uint16_t pulse)
+{
+	gwaveio_pulse_result = pulse;
+	gwaveio_pulse_done = true;
+}
+
+/*
+ * Get the 32-bit time stamp for the value captured by given timer.
+ * The time stamp is the overflow count * counter range (MOD + 1) plus the captured value.
+ * For the input channels the range is 0x10000 (the timer cannot be in PWM mode), so
+ * this is the overflow count in upper 16 bits and the captured value in lower 16 bits.
+ * Must be called from the TPM event handler.
+ * param tpm_index index of the TPM timer
+ * param cntval the captured value (CnV) */
+static uint32_t waveio_get_time(uint8_t tpm_index, uint16_t cntval)
+{
+	uint8_t tpm_channel;
+	uint32_t ovf, cnt;
+
+	// The driver reads the counter and the pending overflow flag so that they belong together
+	cnt = waveio_get_tpm_driver(gwaveio_tpm_first_channel[tpm_index], &tpm_channel)->CounterRead();
+
+	// The overflows reported so far are counted in gwaveio_overflow_cnt (the TPM driver
+	// reports TOF before the channel events and we are in the TPM ISR, so it cannot change now).
+	// Pending overflow is not counted yet.
+	// If the captured value is higher than the counter now, the counter overflowed after
+	// the capture, so the edge belongs to the period before the last overflow.
+	ovf = gwaveio_overflow_cnt[tpm_index];
+	if ( cnt & MSF_TPM_COUNTER_TOF )
+		ovf++;
+	if ( cntval > (cnt & 0xffff) )
+		ovf--;
+
+	return ovf * gwaveio_counter_range[tpm_index] + cntval;
+}
+
+#if WAVEIO_SERVO_GROUPS > 0
+/* Find the servo group for given channel; WAVEIO_SERVO_FREE finds free group
+ * @return pointer to the group or null if not found */
+static waveio_servo_group* waveio_servo_find(uint8_t channel)
+{
+	uint8_t i;
+
+	for ( i = 0; i < WAVEIO_SERVO_GROUPS; i++ )
+	{
+		if ( gwaveio_servo[i].channel == channel )
+			return &gwaveio_servo[i];
+	}
+	return null;
+}
+
+/* Prepare the schedule for the next frame from the requested pulses.
+ * The pulses follow each other in the order of the slots. If they do not fit
+ * into the frame, the frame is extended.
+ * The schedule is built aside and then copied to the unused half of the
+ * double buffer with interrupts disabled; the ISR switches to it at the start
+ * of the next frame. */
+static void waveio_servo_update(waveio_servo_group* g)
+{
+	waveio_servo_schedule s;
+	uint32_t total = 0;
+	uint8_t slot;
+
+	s.count = 0;
+	for ( slot = 0; slot < WAVEIO_SERVOS_PER_CHANNEL; slot++ )
+	{
+		if ( !(g->attached & (1 << slot)) || g->pulse[slot] == 0 )
+			continue;
+
+		s.len[s.count] = (g->pulse[slot] < WAVEIO_SERVO_MIN_GAP) ? WAVEIO_SERVO_MIN_GAP : g->pulse[slot];
+		s.slot[s.count] = slot;
+		total += s.len[s.count];
+		s.count++;
+	}
+	s.gap = (total + WAVEIO_SERVO_MIN_GAP < WAVEIO_SERVO_FRAME) ?
+			(uint16_t)(WAVEIO_SERVO_FRAME - total) : WAVEIO_SERVO_MIN_GAP;
+
+	MSF_ATOMIC_BEGIN();
+	g->sched[g->active ^ 1] = s;
+	g->pending = 1;
+	MSF_ATOMIC_END();
+}
+
+/* Get the handler for channel events of given timer; either the waveio handler
+ * or the servo handler */
+static MSF_TPM_Channel_Event_t waveio_get_channel_handler(uint8_t tpm_index, bool servo)
+{
+	switch ( tpm_index )
+	{
+#if (MSF_DRIVER_TPM0)
+	case 0:
+		return (servo) ? waveio_servo_event0 : waveio_timer0_channel;
+#endif
+#if (MSF_DRIVER_TPM1)
+	case 1:
+		return (servo) ? waveio_servo_event1 : waveio_timer1_channel;
+#endif
+#if (MSF_DRIVER_TPM2)
+	case 2:
+		return (servo) ? waveio_servo_event2 : waveio_timer2_channel;
+#endif
+	}
+	return null;
+}
+
+#if (MSF_DRIVER_TPM0)
+/* Handler for the channel events of TPM0 channels which drive servos */
+static void waveio_servo_event0(uint32_t tpm_channel, uint32_t value)
+{
+	waveio_on_servo_event(0, tpm_channel, tpm_channel, (uint16_t)value);
+}
+#endif
+
+#if (MSF_DRIVER_TPM1)
+static void waveio_servo_event1(uint32_t tpm_channel, uint32_t value)
+{
+	waveio_on_servo_event(1, tpm_channel, tpm_channel + 6, (uint16_t)value);
+}
+#endif
+
+#if (MSF_DRIVER_TPM2)
+static void waveio_servo_event2(uint32_t tpm_channel, uint32_t value)
+{
+	waveio_on_servo_event(2, tpm_channel, tpm_channel + 8, (uint16_t)value);
+}
+#endif
+
+/*
+ * Generate the servo pulses.
+ * The pulses are generated one after another: each compare match ends the pulse
+ * of one servo and starts the pulse of the next one, so only one pin is high at a time.
+ * After the last pulse the match waits for the start of the next frame.
+ * The next compare value is computed from the value of this match, so the interrupt
+ * latency does not accumulate.
+ * param cntval the compare value which caused this event */
+static void waveio_on_servo_event(uint8_t tpm_index, uint8_t tpm_channel, uint8_t channel, uint16_t cntval)
+{
+	waveio_servo_group* g = waveio_servo_find(channel);
+	waveio_servo_schedule* s;
+	MSF_DRIVER_TPM* pdrv;
+	MCU_pin_t pin;
+	uint16_t compare;
+
+	if ( !g )
+		return;
+
+	s = &g->sched[g->active];
+	if ( g->next > s->count )
+	{
+		// Start of new frame; use the new schedule if there is one
+		if ( g->pending )
+		{
+			g->active ^= 1;
+			g->pending = 0;
+			s = &g->sched[g->active];
+		}
+		g->next = 0;
+	}
+	else
+	{
+		// End the pulse in progress
+		pin = g->pin[s->slot[g->next - 1]];
+		GPIO_CLEAR_REG(pin) = GPIO_PIN_MASK(pin);
+	}
+
+	if ( g->next < s->count )
+	{
+		// Start the pulse of the next servo
+		pin = g->pin[s->slot[g->next]];
+		GPIO_SET_REG(pin) = GPIO_PIN_MASK(pin);
+		compare = s->len[g->next];
+	}
+	else
+		compare = s->gap;	// wait for the next frame
+	g->next++;
+
+	pdrv = waveio_get_tpm_driver(channel, &tpm_channel);
+	pdrv->ChannelWrite(tpm_channel, (uint16_t)(cntval + compare));
+}
+#endif	/* WAVEIO_SERVO_GROUPS > 0 */
+
 /** @}*/ 
  
@@ -56,7 +56,39 @@
  * waveio_in_read(channel, half-wave1, half-vave2);<br>
  * OR<br>
  * Wait for a pulse on the input: waveio_in_pulse_wait(channel, timeout);<br>
+ * OR<br>
+ * Start measuring a pulse and get the result in your callback: waveio_in_pulse_start(channel, timeout, callback);<br>
+ * This does not block the program, so pulses on several channels can be measured at the same time.<br>
  * You specify the lengths of the half-waves in microseconds.<br>
+ * <br>
+ * To record all the edges on the input (e.g. to decode RC PPM, IR remote or
+ * Manchester signal)<br>
+ * 1) Initialize and attach the channel as above.<br>
+ * 2) Start the log with your buffer: waveio_in_log_start(channel, buffer, size);<br>
+ * 3) Read the recorded edges in batches: n = waveio_in_log_read(channel, edges, max);<br>
+ * Each edge has 32-bit time stamp in timer ticks and the level of the pin after the edge.<br>
+ * <br>
+ * To drive many RC servos<br>
+ * One waveio channel can drive up to WAVEIO_SERVOS_PER_CHANNEL servos connected to
+ * any GPIO pins. The timer channel is used only to time the pulses; its own pin is not used.<br>
+ * 1) Initialize: waveio_init(range of used channels);<br>
+ * 2) Attach the servos: waveio_servo_attach(channel, slot, pin); for slot 0, 1,...<br>
+ * 3) Set the positions: waveio_servo_write_us(channel, slot, us); or waveio_servo_write_all_us<br>
+ * The pulses of a channel are generated back to back in the order of the slots within
+ * the 20 ms frame: the end of one pulse is the start of the next one. So there is one
+ * interrupt per servo plus one per frame, and only one servo pin is high at a time
+ * (the servos do not draw their start-up current at the same moment).
+ * 8 pulses of max. length (8 x WAVEIO_SERVO_MAX_US) do not fit into the 20 ms frame;
+ * in such case the frame is extended, which the servos tolerate.
+ * The new positions are applied at the start of the next frame, all at once.<br>
+ * <br>
+ * To generate several signals with defined phase shift (e.g. for motor drivers)<br>
+ * 1) Initialize: waveio_init(range of used channels);<br>
+ * 2) Fill array of WAVEIO_GROUP_CHANNEL with the channel, half-waves and phase of each signal.<br>
+ * 3) Start all the signals at once: waveio_out_group_start(group, count, 0);<br>
+ * 4) Change the signals: waveio_out_group_change(group, count); the new values
+ * are used from the start of the next period of each signal, so the phases are kept.<br>
+ * The channels can be on any of the timers TPM0, TPM1, TPM2.<br>
 
  *
  * <b>Useful equations</b><br>
@@ -82,10 +114,14 @@
  *
  * For generating the output signal, waveio driver uses the timer in output compare mode
  * with pin toggle on compare match.
- * It would be possible to achieve higher maximum frequencies using PWM mode of the timer,
- * but the PWM mode requires that the period of the signal is tied to the value at
- * which the timer counter overflows. So all the channels of one physical
- * timer (TPM driver) have to have the same frequency.
+ * If all the output channels of one physical timer (TPM driver) have the same period
+ * and no channel of this timer is used as input, the driver switches the timer to
+ * PWM mode with the period of the signal set as the counter overflow (MOD) value.
+ * The signal is then generated by the timer hardware without any interrupts, so the
+ * limits given above do not apply. As soon as a channel with different period or
+ * an input channel is started on this timer, the driver switches back to the toggle mode.
+ * This is typically the case for servo signals (all channels have 20 ms period).
+ * The PWM mode can be disabled by defining WAVEIO_USE_HW_PWM to 0 in msf_config.h.
  * <br>
  * Longest half-wave length is:<br>
  *	65535 for the CPU clock options which allow obtaining 1 MHz timer clock.
@@ -148,9 +184,59 @@ extern "C" {
 #define	WAVEIO_ERROR_UNINITIALIZED_CHANNEL	(MSF_ERROR_LAST+3)	/**< given channel number was not initialized in call to waveio_init() */
 #define	WAVEIO_ERROR_INACTIVE_CHANNEL		(MSF_ERROR_LAST+4)	/**< given channel number is not active (used when stopping a channel)*/
 #define	WAVEIO_TIMEOUT						MSF_ERROR_TIMEOUT	/**< timeout occurred while waiting for edge */
+#define	WAVEIO_ERROR_NO_SERVO_GROUP			(MSF_ERROR_LAST+5)	/**< no more channels can be used for servos, see WAVEIO_SERVO_GROUPS */
 
 /** @}*/
 
+/** One signal of a group of output signals, see waveio_out_group_start. */
+typedef struct waveio_group_channel
+{
+	WAVEIO_channel channel;	/**< the channel to generate the signal on */
+	uint16_t half1;			/**< the length of the 1st part of the wave (pulse, high level) in microseconds */
+	uint16_t half2;			/**< the length of the 2nd part of the wave (low level) in microseconds */
+	uint16_t phase;			/**< delay of the 1st pulse after the start of the group in microseconds */
+} WAVEIO_GROUP_CHANNEL;
+
+/** Flag for waveio_out_group_start: reset the counters of the timers used by the group.
+ * Only allowed if the timers have no other channels in use; the counters are never
+ * stopped, so without this flag the other channels continue without disturbance. */
+#define	WAVEIO_GROUP_RESET_COUNTER	(1UL << 0)
+
+/** @brief Callback function for the asynchronous pulse measurement, see waveio_in_pulse_start.
+ * @param channel the channel on which the pulse was measured
+ * @param pulse the length of the pulse in microseconds or 0 if the timeout occurred.
+ * @note It is called from the timer interrupt handler.
+ */
+typedef void (*WAVEIO_Pulse_Event_t)(WAVEIO_channel channel, uint16_t pulse);
+
+/** One edge recorded by the input log, see waveio_in_log_start. */
+typedef struct waveio_edge
+{
+	uint32_t time;		/**< time stamp in timer ticks; 16 bits of overflow count and 16 bits of the counter */
+	uint8_t level;		/**< level of the pin after the edge; 1 = rising edge, 0 = falling edge */
+} WAVEIO_EDGE;
+
+/** Number of waveio channels which can drive multiple servos (see waveio_servo_attach).
+ * Each needs about 80 bytes of RAM. Define as 0 in msf_config.h to disable this feature. */
+#ifndef WAVEIO_SERVO_GROUPS
+	#define	WAVEIO_SERVO_GROUPS		(2)
+#endif
+
+/** Max number of servos driven by one waveio channel */
+#define	WAVEIO_SERVOS_PER_CHANNEL	(8)
+
+/** The period of the servo signal (frame) in microseconds */
+#define	WAVEIO_SERVO_FRAME_US		(20000)
+
+/** Longest servo pulse in microseconds */
+#define	WAVEIO_SERVO_MAX_US			(3000)
+
+/** Use the PWM mode of the timer for outputs if possible (all the outputs of the
+ * timer have the same period). Define as 0 in msf_config.h to always generate the
+ * outputs in toggle mode with ISR. */
+#ifndef WAVEIO_USE_HW_PWM
+	#define	WAVEIO_USE_HW_PWM	(1)
+#endif
 
 
 /* WMSF_WAVEIO_PRESCALER
@@ -339,10 +425,56 @@ uint8_t waveio_out_servo_us(WAVEIO_channel iochannel, uint16_t us);
  * @note The function will wait for the pin to become low before it returns so
  * it may block the caller up to the half2 microseconds of the current signal.
  * At most this could be about 65 ms.
+ * If the channel is generated in PWM mode, the function does not wait; it sets 0% duty
+ * and the pin is disconnected in the timer ISR on the next match (within one period).
  *
  */
 uint8_t waveio_out_stop(WAVEIO_channel iochannel);
 
+/**
+ * @brief Start generating signals on several channels with defined phase shift.
+ * @param group array with the channels and their signals
+ * @param count number of items in group
+ * @param flags 0 or WAVEIO_GROUP_RESET_COUNTER
+ * @return WAVEIO_NO_ERROR (0) if OK; WAVEIO_ERROR_INVALID_CHANNEL, WAVEIO_ERROR_UNINITIALIZED_CHANNEL
+ *  or MSF_ERROR_ARGUMENT on error; also if the group would disturb the other channels of its
+ *  timers: with WAVEIO_GROUP_RESET_COUNTER, or if such timer generates its outputs in PWM mode.
+ * @note The pulse (half1) of each signal starts "phase" microseconds after a common
+ * start time, which is up to one half2 (the longest in the group) after the call.
+ * The counters are not stopped. The counters of the timers used by the group are read
+ * one after another with interrupts disabled and each signal starts relative to its own
+ * timer, so the phases across timers are exact within the skew: the time of one counter
+ * read, typically below 1 us (1 timer tick) at 48 MHz CPU clock. The measured skew is
+ * returned by waveio_out_group_skew.<br>
+ * The hardware global time base (Control with MSF_TPM_GTB_ENABLE in the TPM driver)
+ * is not used: it would switch all the channels of a timer to the other counter,
+ * including the ones already running, and waveio uses the counter of each timer for the
+ * time stamps and timeouts.<br>
+ * The channels of the group never use the PWM mode (see WAVEIO_USE_HW_PWM) because
+ * it does not allow the phase shift. Stop the channels by waveio_out_stop.
+ */
+uint8_t waveio_out_group_start(const WAVEIO_GROUP_CHANNEL* group, uint8_t count, uint32_t flags);
+
+/**
+ * @brief Get the skew of the timers measured by the last waveio_out_group_start.
+ * @return the time in microseconds from reading the counter of the first timer of the group
+ *  until the counters of all its timers were read; 0 if no group was started.
+ * @note The signals on different timers may be shifted by up to this time.
+ */
+uint16_t waveio_out_group_skew(void);
+
+/**
+ * @brief Change the signals generated by a group of channels.
+ * @param group array with the channels and their new half-waves; the phase is ignored.
+ * @param count number of items in group
+ * @return WAVEIO_NO_ERROR (0) if OK; WAVEIO_ERROR_INVALID_CHANNEL, WAVEIO_ERROR_INACTIVE_CHANNEL
+ *  (the channel was not started by waveio_out_group_start) or MSF_ERROR_ARGUMENT on error.
+ * @note The function does not wait. Each signal uses the new values from the start of
+ * its next pulse, so the signals with the same period stay in phase also if the period
+ * is changed.
+ */
+uint8_t waveio_out_group_change(const WAVEIO_GROUP_CHANNEL* group, uint8_t count);
+
 /**
  * @brief Connect given channel to the driver as input.
  * @param iochannel the channel to attach.
@@ -392,6 +524,8 @@ uint8_t waveio_in_stop(WAVEIO_channel iochannel);
  * Also do not assume any particular order of the parts. For example, if measuring RC PPM signal,
  * the pulse may be in part A or part B depending on when the measurement started (or
  * when the input signal was connected).
+ * The part longer than the timer counter range (65535 ticks) is reported as the maximum
+ * value, that is 65535 us for 1 MHz timer clock.
  *
  */
 uint8_t waveio_in_read(WAVEIO_channel iochannel, uint16_t* pulseA, uint16_t* pulseB  );
@@ -411,6 +545,34 @@ uint8_t waveio_in_read(WAVEIO_channel iochannel, uint16_t* pulseA, uint16_t* pul
  **/
 uint16_t waveio_in_pulse_wait(WAVEIO_channel iochannel, uint32_t timeout );
 
+/**
+ * @brief Start measuring a pulse (2 edges) on given channel without waiting for it.
+ * @param iochannel the channel on which we want to measure. It must be attached as input
+ *  (waveio_in_attach) and must not record the edges into the log (waveio_in_log_start).
+ * @param timeout maximum time in milliseconds to wait for the pulse. If 0 is specified, wait infinitely.
+ *  The timeout is "rough", as for waveio_in_pulse_wait.
+ * @param callback the function called with the length of the pulse or with 0 if
+ *  the timeout occurs. It is called only once for each call of this function.
+ * @return WAVEIO_NO_ERROR (0) if OK; WAVEIO_ERROR_INVALID_CHANNEL, WAVEIO_ERROR_UNINITIALIZED_CHANNEL,
+ *  WAVEIO_ERROR_INACTIVE_CHANNEL (not input) or MSF_ERROR_ARGUMENT (null callback) on error.
+ * @note This is asynchronous version of waveio_in_pulse_wait. The pulse length is
+ * delivered by the timer interrupt, so the program can continue and measure several channels
+ * at the same time.
+ * Must be called before the 1st edge occurs on the input pin!
+ * Calling it again for the same channel restarts the measurement (the previous one is cancelled
+ * without calling the callback).
+ *
+ **/
+uint8_t waveio_in_pulse_start(WAVEIO_channel iochannel, uint32_t timeout, WAVEIO_Pulse_Event_t callback);
+
+/**
+ * @brief Cancel the pulse measurement started by waveio_in_pulse_start.
+ * @param iochannel the channel
+ * @return WAVEIO_NO_ERROR (0) if OK; WAVEIO_ERROR_INVALID_CHANNEL if the channel is not valid.
+ * @note The callback is not called for the cancelled measurement.
+ **/
+uint8_t waveio_in_pulse_cancel(WAVEIO_channel iochannel);
+
 /**
  * @brief Read input from an RC receiver on given channel.
  * @param iochannel the channel for which we want to read the input.
@@ -422,6 +584,101 @@ uint16_t waveio_in_pulse_wait(WAVEIO_channel iochannel, uint32_t timeout );
 */
 uint16_t waveio_in_servo_read_us(WAVEIO_channel iochannel);
 
+/**
+ * @brief Attach servo to given channel.
+ * @param iochannel the channel which times the pulses.
+ * @param slot number of the servo within the channel; 0 thru WAVEIO_SERVOS_PER_CHANNEL-1.
+ * @param pin the pin to which the servo is connected (any GPIO pin), e.g. GPIO_B0.
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ * @note The first servo attached to a channel takes the channel over; it cannot be used
+ * for other waveio functions until all its servos are detached. The timer of this channel
+ * cannot use the PWM mode for its outputs (see WAVEIO_USE_HW_PWM) while it drives servos.<br>
+ * No pulses are generated for the servo until its position is set.
+ */
+uint8_t waveio_servo_attach(WAVEIO_channel iochannel, uint8_t slot, MCU_pin_t pin);
+
+/**
+ * @brief Detach servo from given channel.
+ * @param iochannel the channel.
+ * @param slot number of the servo within the channel.
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ * @note The pulse in progress is completed. When the last servo is detached, the channel
+ * can be used for other functions.
+ */
+uint8_t waveio_servo_detach(WAVEIO_channel iochannel, uint8_t slot);
+
+/**
+ * @brief Set position of servo attached to given channel.
+ * @param iochannel the channel.
+ * @param slot number of the servo within the channel.
+ * @param us the pulse width in microseconds, typically 1000 thru 2000; max. WAVEIO_SERVO_MAX_US.
+ * 0 stops the pulses for this servo.
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ * @note The new value is used from the next frame.
+ */
+uint8_t waveio_servo_write_us(WAVEIO_channel iochannel, uint8_t slot, uint16_t us);
+
+/**
+ * @brief Set position of servo attached to given channel in degrees.
+ * @param iochannel the channel.
+ * @param slot number of the servo within the channel.
+ * @param angle the angle between 0 and 180
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ */
+uint8_t waveio_servo_write(WAVEIO_channel iochannel, uint8_t slot, uint8_t angle);
+
+/**
+ * @brief Set positions of several servos attached to given channel at once.
+ * @param iochannel the channel.
+ * @param us array with the pulse widths in microseconds for slots 0 thru count-1.
+ * @param count number of items in the us array.
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ * @note All the new values are used from the same frame. The values for not attached
+ * slots are ignored.
+ */
+uint8_t waveio_servo_write_all_us(WAVEIO_channel iochannel, const uint16_t* us, uint8_t count);
+
+/**
+ * @brief Start recording all the edges on given input channel.
+ * @param iochannel the channel to record. Must be attached by waveio_in_attach.
+ * @param buffer user-provided buffer for the edges (ring buffer). Must exist while the log runs.
+ * @param size number of items in the buffer; must be power of 2, 2 thru 32768.
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ * @note The edges are stored by the ISR and read by waveio_in_log_read. If the buffer
+ * is full, new edges are dropped and counted, see waveio_in_log_lost.<br>
+ * The time stamps are in timer ticks (1 us for the CPU clocks with WAVEIO_MULT_FACTOR = 1).
+ * They overflow after 2^32 ticks (about 71 minutes at 1 MHz), so compute the intervals
+ * as difference of two time stamps in uint32_t.<br>
+ * The level of the pin is read once by this function; then it is toggled on each
+ * captured edge, so it is right also for pulses shorter than the interrupt latency.
+ * The pin should not change while this function runs.
+ */
+uint8_t waveio_in_log_start(WAVEIO_channel iochannel, WAVEIO_EDGE* buffer, uint16_t size);
+
+/**
+ * @brief Stop recording the edges on given input channel.
+ * @param iochannel the channel.
+ * @return WAVEIO_NO_ERROR (0) if OK; error code otherwise, see waveio.h
+ * @note The edges which are in the buffer can still be read by waveio_in_log_read.
+ */
+uint8_t waveio_in_log_stop(WAVEIO_channel iochannel);
+
+/**
+ * @brief Read the edges recorded on given channel.
+ * @param iochannel the channel.
+ * @param edges user-provided array which receives the edges (oldest first).
+ * @param max the maximum number of edges to read (size of the edges array).
+ * @return the number of edges copied to edges array; 0 if there are none.
+ */
+uint16_t waveio_in_log_read(WAVEIO_channel iochannel, WAVEIO_EDGE* edges, uint16_t max);
+
+/**
+ * @brief Get the number of edges dropped because the log buffer was full.
+ * @param iochannel the channel.
+ * @return the number of edges lost since the last call (the counter is reset).
+ */
+uint16_t waveio_in_log_lost(WAVEIO_channel iochannel);
+
 
 
 #ifdef __cplusplus
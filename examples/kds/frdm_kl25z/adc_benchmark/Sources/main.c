@@ -0,0 +1,275 @@
+/*
+ * Sample program for MSF lite
+ *
+ * ADC benchmark - measures how long the analog reading takes for various
+ * configurations of the ADC (resolution, hardware averaging) and for various
+ * ways of reading:
+ * - single: repeated reading of one pin with msf_analog_read
+ * - scan: reading of several pins in turn with msf_analog_read; some of the pins
+ *   require switching the ADC A/B channel mux
+ * - stream: continuous conversions in interrupt mode; each result is reported
+ *   by the driver callback.
+ * For the single and scan modes also the time of the same conversions done by
+ * direct access to the ADC registers is measured ("bare"); the difference is
+ * the overhead of the driver (and msf_analog_read) per read.
+ *
+ * The results are printed to the Open SDA virtual serial port (UART0) as
+ * comma-separated values, one line per measurement, so that they can be
+ * captured by terminal program and compared by a script. The first line is
+ * the header with the names of the columns:
+ * mode,res_bits,avg,reads,total_us,conv_per_s,overhead_ns
+ *
+ * mode - single, scan, stream, bare_single or bare_scan
+ * res_bits - ADC resolution
+ * avg - number of samples averaged by hardware (1 = no averaging)
+ * reads - number of readings (conversions) measured
+ * total_us - the time of all the readings in microseconds
+ * conv_per_s - conversions per second
+ * overhead_ns - driver overhead per read in ns, i.e. the time per read minus the time
+ * 		per read with direct register access. 0 for bare and stream modes.
+ *
+ * The terminal should be set to 19200 bd (see MSF_STDIO_BAUDRATE in msf_config.h).
+ * The measurement is repeated after any char is received from the terminal.
+ *
+ * The same measurements without the board, with the driver running against simulated
+ * ADC registers and a model of the conversion time, are in test/host/adc_bench.c.
+ *
+ */
+
+/* MSF configuration for this project */
+#include "msf_config.h"
+/* Include the core definitions - CMSIS <device>.h file etc.*/
+#include "coredef.h"
+#include "msf.h"
+
+#include "drv_adc.h"	/* ADC driver */
+#include "coniob.h"		/* Buffered console I/O */
+
+
+#define	RED_LED		GPIO_B18
+#define	GREEN_LED	GPIO_B19
+
+/* Number of readings for single and scan modes */
+#define	BENCH_READS			(1000)
+/* Time in ms for which the stream mode runs */
+#define	BENCH_STREAM_MS		(100)
+
+/* The pin used in single mode; available in both A and B mux setting */
+#define	BENCH_PIN			AIN_B0
+
+/* The pins used in scan mode. E21 is available only with ADC A and D1 only with
+ * ADC B, so the mux must be switched for these. */
+static const Analog_pin_t bench_scan_pins[] = { AIN_E20, AIN_E21, AIN_D1, AIN_B0 };
+#define	BENCH_SCAN_PINS		(sizeof(bench_scan_pins)/sizeof(bench_scan_pins[0]))
+
+/* The tested configurations */
+static const uint32_t bench_res_flags[] = { MSF_ADC_RES_8_BITS, MSF_ADC_RES_10_BITS,
+		MSF_ADC_RES_12_BITS, MSF_ADC_RES_16_BITS };
+static const uint8_t bench_res_bits[] = { 8, 10, 12, 16 };
+
+static const uint32_t bench_avg_flags[] = { MSF_ADC_AVERAGE_NONE, MSF_ADC_AVERAGE_4,
+		MSF_ADC_AVERAGE_8, MSF_ADC_AVERAGE_16, MSF_ADC_AVERAGE_32 };
+static const uint8_t bench_avg_samples[] = { 1, 4, 8, 16, 32 };
+
+/* Counter of conversions in stream mode */
+static volatile uint32_t bench_stream_cnt;
+
+// prototypes
+void adc_benchmark(void);
+void bench_print_result(const char* mode, uint8_t res, uint8_t avg, uint32_t reads,
+		uint32_t total_us, uint32_t ref_us);
+uint32_t bench_single(void);
+uint32_t bench_scan(void);
+uint32_t bench_bare_single(void);
+uint32_t bench_bare_scan(void);
+uint32_t bench_stream(void);
+void ADC_SignalEvent(uint32_t event, uint32_t arg);
+
+
+int main(void)
+{
+	char c;
+
+	/* Always initialise the MSF library*/
+	msf_init(0);
+
+	msf_pin_direction(RED_LED, output);
+	msf_pin_write(RED_LED, true);
+	msf_pin_direction(GREEN_LED, output);
+	msf_pin_write(GREEN_LED, true);
+
+	/* Re-initialize the ADC driver with our callback; needed for the stream mode */
+	Driver_ADC0.Initialize(ADC_SignalEvent);
+
+	while (1)
+	{
+		msf_pin_write(GREEN_LED, false);
+		adc_benchmark();
+		msf_pin_write(GREEN_LED, true);
+
+		/* wait for any char from the terminal and repeat */
+		while ( coniob_kbhit() == 0 )
+			;
+		c = coniob_getch();
+		(void)c;
+	}
+
+    /* Never leave main */
+    return 0;
+}
+
+/* Run all the measurements for all the configurations and print the results */
+void adc_benchmark(void)
+{
+	uint32_t r, a;
+	uint32_t t, ref;
+
+	msf_print("mode,res_bits,avg,reads,total_us,conv_per_s,overhead_ns\n");
+
+	for ( r = 0; r < sizeof(bench_res_flags)/sizeof(bench_res_flags[0]); r++ )
+	{
+		for ( a = 0; a < sizeof(bench_avg_flags)/sizeof(bench_avg_flags[0]); a++ )
+		{
+			Driver_ADC0.Control(bench_res_flags[r] | bench_avg_flags[a], 0);
+
+			ref = bench_bare_single();
+			bench_print_result("bare_single", bench_res_bits[r], bench_avg_samples[a],
+					BENCH_READS, ref, ref);
+			t = bench_single();
+			bench_print_result("single", bench_res_bits[r], bench_avg_samples[a],
+					BENCH_READS, t, ref);
+
+			ref = bench_bare_scan();
+			bench_print_result("bare_scan", bench_res_bits[r], bench_avg_samples[a],
+					BENCH_READS, ref, ref);
+			t = bench_scan();
+			bench_print_result("scan", bench_res_bits[r], bench_avg_samples[a],
+					BENCH_READS, t, ref);
+
+			t = bench_stream();
+			bench_print_result("stream", bench_res_bits[r], bench_avg_samples[a],
+					t, BENCH_STREAM_MS * 1000UL, BENCH_STREAM_MS * 1000UL);
+		}
+	}
+
+	/* Restore the default settings */
+	Driver_ADC0.Control(MSF_ADC_RES_16_BITS | MSF_ADC_AVERAGE_4 | MSF_ADC_ABSEL_A, 0);
+}
+
+/* Print one line of the results
+ * total_us is the time of the measured reads, ref_us the time of the same reads
+ * with direct register access (used to compute the overhead). */
+void bench_print_result(const char* mode, uint8_t res, uint8_t avg, uint32_t reads,
+		uint32_t total_us, uint32_t ref_us)
+{
+	uint32_t overhead = 0;
+
+	if ( total_us > ref_us )
+		overhead = ((total_us - ref_us) * 1000UL) / reads;
+
+	msf_print(mode);
+	msf_print(",");
+	msf_printnum(res);
+	msf_print(",");
+	msf_printnum(avg);
+	msf_print(",");
+	msf_printnum(reads);
+	msf_print(",");
+	msf_printnum(total_us);
+	msf_print(",");
+	msf_printnum((total_us > 0) ? (uint32_t)(((uint64_t)reads * 1000000UL) / total_us) : 0);
+	msf_print(",");
+	msf_printnum(overhead);
+	msf_print("\n");
+}
+
+/* Read one pin using msf_analog_read; return the time in us */
+uint32_t bench_single(void)
+{
+	uint32_t n, start;
+
+	start = msf_micros();
+	for ( n = 0; n < BENCH_READS; n++ )
+		msf_analog_read(BENCH_PIN);
+
+	return msf_micros() - start;
+}
+
+/* Read several pins in turn using msf_analog_read; return the time in us */
+uint32_t bench_scan(void)
+{
+	uint32_t n, start;
+
+	start = msf_micros();
+	for ( n = 0; n < BENCH_READS; n++ )
+		msf_analog_read(bench_scan_pins[n % BENCH_SCAN_PINS]);
+
+	return msf_micros() - start;
+}
+
+/* Read one pin by direct access to the ADC registers; return the time in us */
+uint32_t bench_bare_single(void)
+{
+	uint32_t n, start;
+	uint32_t channel = MSF_PIN2CHANNEL(BENCH_PIN);
+
+	start = msf_micros();
+	for ( n = 0; n < BENCH_READS; n++ )
+	{
+		ADC0->SC1[0] = ADC_SC1_ADCH(channel);
+		while ( !WMSF_ADCA_COMPLETE(ADC0) ) ;
+		(void)ADC0->R[0];
+	}
+
+	return msf_micros() - start;
+}
+
+/* Read several pins by direct access to the ADC registers; the A/B mux is
+ * switched only when needed; return the time in us */
+uint32_t bench_bare_scan(void)
+{
+	uint32_t n, start;
+	Analog_pin_t pin;
+
+	start = msf_micros();
+	for ( n = 0; n < BENCH_READS; n++ )
+	{
+		pin = bench_scan_pins[n % BENCH_SCAN_PINS];
+		if ( ((uint32_t)pin & MSF_ADC_BOTH) != MSF_ADC_BOTH )
+		{
+			if ( MSF_ADC_ISA_CHANNEL(pin) )
+				ADC0->CFG2 &= ~ADC_CFG2_MUXSEL_MASK;
+			else
+				ADC0->CFG2 |= ADC_CFG2_MUXSEL_MASK;
+		}
+		ADC0->SC1[0] = ADC_SC1_ADCH(MSF_PIN2CHANNEL(pin));
+		while ( !WMSF_ADCA_COMPLETE(ADC0) ) ;
+		(void)ADC0->R[0];
+	}
+
+	return msf_micros() - start;
+}
+
+/* Run continuous conversions in interrupt mode for BENCH_STREAM_MS;
+ * return the number of conversions */
+uint32_t bench_stream(void)
+{
+	Driver_ADC0.SetChannel(MSF_PIN2CHANNEL(BENCH_PIN));
+	Driver_ADC0.Control(MSF_ADC_MODE_INT | MSF_ADC_CONV_CONTINUOUS, 0);
+	bench_stream_cnt = 0;
+
+	Driver_ADC0.Read();		/* start the conversions */
+	msf_delay_ms(BENCH_STREAM_MS);
+
+	/* stop */
+	Driver_ADC0.Control(MSF_ADC_MODE_POLLED | MSF_ADC_CONV_SINGLE, 0);
+
+	return bench_stream_cnt;
+}
+
+/* Callback for the ADC driver */
+void ADC_SignalEvent(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_ADC_EVENT_CONV_COMPLETE )
+		bench_stream_cnt++;
+}
@@ -0,0 +1,259 @@
+/*
+  input_capture_pt example for MSF
+
+  This is the input_capture example rewritten with protothreads (pt.h).
+  It uses the TPM timer in input capture mode to measure the length of the pulses.
+  Instead of pairing the edges in the timer event handler, the measuring is written
+  as sequential code in a protothread: wait for the first edge, wait for the second edge,
+  compute the length. Another thread blinks the green LED at the same time and
+  the measuring thread reports if there is no signal on the input.
+
+  The example works with square wave input signal (50% duty).
+  It can also handle signal from RC transceivers (pulses between 1 and 2 ms with about 50 Hz period)
+  - for this set SERVO_SIGNAL to 1 below.
+
+  Testing the program:
+  - open terminal emulator on your PC (e.g. Tera Term or Putty)
+   and open the OpenSDA COM port and set baudrate to 19200
+  - run this example project
+  - connect input signal to the selected pin of your FRDM board (see below)
+  You should see the measured length of the pulses in your terminal window.
+
+  Without changes in code this example works with 48 MHZ F_CPU.
+  It sets timer clock to 1 MHz, which means "1" in the counter
+  amounts to 1 microsecond (1 us). The longest pulse it can measure
+  is about 65 ms (input signals from about 8 Hz up).
+
+  Note that the edges which come while the thread prints the result (msf_print waits until
+  the text is sent) are not captured; only the pulses which come after are measured.
+
+  INPUT PINS
+  You can select one of the pins (timer channels) below by changing the
+  TIMER_CHANNEL define below;
+  For the mapping of the pins to timer channels see the msf_config.h in this project
+  (Project Explorer > input_capture_pt > Sources folder).
+
+ */
+
+/* MSF configuration for this project */
+#include "msf_config.h"
+/* Include the core definitions - CMSIS <device>.h file etc.*/
+#include "coredef.h"
+#include "msf.h"
+
+#include "drv_tpm.h"	/* TPM timer driver */
+#include "pt.h"			/* Protothreads */
+
+
+/*
+ INPUT PINS = Timer channels:
+  Pin: D0 (Arduino pin 10) - TPM0, channel 0.
+  Pin: A4 (Arduino pin 4) - TPM0, channel 1.
+  Pin: A5 (Arduino pin 5) - TPM0, channel 2.
+  Pin: D3 (Arduino pin 12) - TPM0, channel 3.
+  Pin: D4 (Arduino pin 2) - TPM0, channel 4.
+  Pin: C9 (Arduino pin 7) - TPM0, channel 5.
+
+  Select one by changing the TIMER_CHANNEL value below:
+ */
+#define TIMER_CHANNEL	(5)
+
+/* Set to 1 for signal from RC receiver; 0 for square wave */
+#define	SERVO_SIGNAL	(0)
+
+/* Report missing signal if there is no edge for this time in ms */
+#define	SIGNAL_TIMEOUT	(1000)
+
+
+#define	RED_LED		GPIO_B18
+#define	GREEN_LED	GPIO_B19
+#define	BLUE_LED	GPIO_D1
+
+// Prototypes
+PT_THREAD(measure_thread(PT* pt));
+PT_THREAD(blink_thread(PT* pt));
+bool process_square(uint16_t pulse);
+bool process_servo(uint16_t pulse);
+
+/* The state of the threads */
+static PT g_measure_pt;
+static PT g_blink_pt;
+
+
+int main(void)
+{
+	// Always initialize the MSF library
+	msf_init(0);
+
+	// Initialize LEDs
+	msf_pin_direction(RED_LED, output);
+	msf_pin_direction(GREEN_LED, output);
+	msf_pin_write(GREEN_LED, true);
+
+	msf_pin_write(RED_LED, false);
+	msf_delay_ms(1500);
+	msf_pin_write(RED_LED, true);
+
+	// Initialize TPM0 timer. No callback is needed; the captures are
+	// reported to the protothread by pt_capture_start.
+	Driver_TPM0.Initialize(null);
+
+	// Set the speed of the timer counter
+	// The timer clock speed depends on F_CPU, see MSF_TPM_CLKSEL in msf_mkl25z.h
+	// It is 8 MHz in default clock setup (48 MHz F_CPU)
+	// Set prescaler to 8 to obtain 1 MHz clock for timer.
+	Driver_TPM0.Control(MSF_TPM_PRESCALER_SET, MSF_TPM_PRESCALER_8);
+
+	// Set the timer channel to input capture mode on both edges.
+	Driver_TPM0.ChannelSetMode(TIMER_CHANNEL, InCapture_both_edges, MSF_TPM_PARAM_CHANNEL_EVENT);
+
+	msf_print("Waiting for signal...\n");
+
+	PT_INIT(&g_measure_pt);
+	PT_INIT(&g_blink_pt);
+
+	while(1)
+	{
+		measure_thread(&g_measure_pt);
+		blink_thread(&g_blink_pt);
+	}
+
+	/* Never leave main */
+	return 0;
+}
+
+/* measure_thread
+ * Measures the time between two edges on the input.
+ * The counter is 16-bit, so the difference of the captured values computed in 16 bits
+ * is correct also if the counter overflowed between the edges (pulses shorter than 65 ms).
+ */
+PT_THREAD(measure_thread(PT* pt))
+{
+	static PT_OP edge;
+	static uint16_t start;
+	static uint32_t t;
+	uint16_t pulse;
+	bool valid;
+
+	PT_BEGIN(pt);
+
+	while (1)
+	{
+		// 1st edge; report if it does not come in time
+		pt_capture_start(&edge, &Driver_TPM0, TIMER_CHANNEL);
+		t = msf_millis();
+		PT_WAIT_UNTIL(pt, edge.done || (msf_millis() - t) >= SIGNAL_TIMEOUT);
+		if ( !edge.done )
+		{
+			msf_print("No signal\n");
+			continue;
+		}
+		start = (uint16_t)edge.result;
+
+		// 2nd edge
+		pt_capture_start(&edge, &Driver_TPM0, TIMER_CHANNEL);
+		PT_AWAIT(pt, &edge);
+		pulse = (uint16_t)edge.result - start;
+
+		// Process the data
+#if SERVO_SIGNAL
+		valid = process_servo(pulse);
+#else
+		valid = process_square(pulse);
+#endif
+		// If we measured the gap between the pulses, skip one edge so that
+		// the next measurement starts at the beginning of the pulse
+		if ( !valid )
+		{
+			pt_capture_start(&edge, &Driver_TPM0, TIMER_CHANNEL);
+			PT_AWAIT(pt, &edge);
+		}
+	}
+
+	PT_END(pt);
+}
+
+/* blink_thread
+ * Blinks the green LED to show that the program runs while it waits for the signal.
+ */
+PT_THREAD(blink_thread(PT* pt))
+{
+	static uint32_t t;
+
+	PT_BEGIN(pt);
+
+	while (1)
+	{
+		msf_pin_toggle(GREEN_LED);
+		PT_DELAY_MS(pt, t, 500);
+	}
+
+	PT_END(pt);
+}
+
+// Process square wave signal
+bool process_square(uint16_t pulse)
+{
+	static int cnt = 0;
+	static long sum = 0;
+
+	sum += pulse;
+	cnt++;
+	if (cnt == 10 )
+	{
+		// Average N pulses
+		sum = sum / 10;
+		msf_print("Pulse: ");
+		msf_printnum(sum);
+		msf_print(" us \n");
+		sum = 0;
+		cnt = 0;
+	}
+	return true;
+}
+
+// Servo signal test
+bool process_servo(uint16_t pulse)
+{
+	static int cnt = 0;
+	static long sum = 0;
+
+	// ignore pulses outside the valid range for RC signal
+	if ( pulse <= 800 || pulse >= 2200 )
+		return false;
+
+	sum += pulse;
+	cnt++;
+	if (cnt == 5 )
+	{
+		// Average N pulses
+		sum = sum / 5;
+		msf_print("Pulse: ");
+		msf_printnum(sum);
+		msf_print(" us \n");
+		sum = 0;
+		cnt = 0;
+	}
+	return true;
+}
+
+
+/* ======================================================================== */
+
+/* handler for the non-maskable (NMI) interrupt.
+ * The PTA4 pin (Arduino pin 4) is by default used as NMI input and
+ * connecting low signal to this pin causes NMI interrupt - the default handler
+ * is just endless loop. This is no problem if we use the PTA4 pin, because we
+ * configure it to a different mode than NMI and all works fine.
+ * However, if we by mistake connect the signal to this pin while it is not used
+ * in the program, the program will hang (go into the default handler).
+*/
+void NMI_Handler(void)
+{
+	// do nothing, just override the default handler which contains endless loop.
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EOF
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+/*
+ * Sample program for MSF lite
+ *
+ * This sample demonstrates the protothreads (pt.h) with the UART and ADC drivers.
+ * It does the same as the interrupt_uart_full_test in the uart example - sends back
+ * texts received through serial line, 5 chars in a row - but the waiting for the
+ * UART is written as simple sequential code in a protothread instead of a state machine.
+ * At the same time another thread reads the analog input A0 and blinks the red LED
+ * with the period given by the voltage on A0 (about 0.1 to 1.1 s). Both threads
+ * run in the stack of main; no RTOS is used.
+ *
+ * On your computer you will need Terminal emulator, for example Tera Term or Hyperterminal
+ * to communicate with the program in the MCU. Set the baudrate to 9600.
+ * Use the Open SDA virtual serial port for communication.
+ * The Open SDA serial port is connected to UART0.
+ *
+ * LEDs:
+ * GREEN - now receiving text
+ * BLUE - on while sending
+ * RED - blinking with the period given by the voltage on A0
+ *
+ */
+
+/* MSF configuration for this project */
+#include "msf_config.h"
+/* Include the core definitions - CMSIS <device>.h file etc.*/
+#include "coredef.h"
+
+#include "msf.h"
+#include "drv_uart.h"	/* UART driver */
+#include "drv_adc.h"	/* ADC driver */
+#include "pt.h"			/* Protothreads */
+
+#define	RED_LED		GPIO_B18
+#define	GREEN_LED	GPIO_B19
+#define	BLUE_LED	GPIO_D1
+
+/* The analog input which sets the blinking period; A0 on the Arduino header */
+#define	BLINK_INPUT	AIN_B0
+
+// prototypes
+PT_THREAD(echo_thread(PT* pt));
+PT_THREAD(blink_thread(PT* pt));
+
+/* The state of the threads */
+static PT g_echo_pt;
+static PT g_blink_pt;
+
+int main(void)
+{
+	/* Always initialise the MSF library*/
+	msf_init(0);
+
+	// Init the LEDs
+	msf_pin_direction(RED_LED, output);
+	msf_pin_direction(GREEN_LED, output);
+	msf_pin_direction(BLUE_LED, output);
+	// When the pin is 0, the LED is on; so turn it off
+	msf_pin_write(RED_LED, true);
+	msf_pin_write(GREEN_LED, true);
+	msf_pin_write(BLUE_LED, true);
+
+	/* Initialise the drivers for the awaitable operations (interrupt mode) */
+	pt_uart_init(&Driver_UART0, BD9600);
+	pt_adc_init();
+	Driver_ADC0.Control(MSF_ADC_RES_12_BITS, 0);
+
+	PT_INIT(&g_echo_pt);
+	PT_INIT(&g_blink_pt);
+
+	/* Run the threads; each call runs the thread until it waits for something */
+	while (1)
+	{
+		echo_thread(&g_echo_pt);
+		blink_thread(&g_blink_pt);
+	}
+
+	/* Never leave main */
+	return 0;
+}
+
+/* echo_thread
+ * Receives 5 chars and sends them back.
+ * Note that the variables used by the thread must be static (or global), because
+ * the thread returns to main() while it waits.
+ */
+PT_THREAD(echo_thread(PT* pt))
+{
+	static char buffer[16];
+	static PT_OP rx;
+	static PT_OP tx;
+	static uint32_t t;
+
+	PT_BEGIN(pt);
+
+	while (1)
+	{
+		/* receive 5 bytes in the background */
+		msf_pin_write(GREEN_LED, false);	// turn LED on
+		pt_uart_receive(&Driver_UART0, &rx, buffer, 5);
+		PT_AWAIT(pt, &rx);
+		msf_pin_write(GREEN_LED, true);		// turn LED off
+
+		/* Send what was received */
+		buffer[5] = '\n';
+		buffer[6] = '\r';
+		msf_pin_write(BLUE_LED, false);		// turn LED on
+		pt_uart_send(&Driver_UART0, &tx, buffer, 7);
+		PT_AWAIT(pt, &tx);
+
+		if ( rx.result & MSF_UART_EVENT_RX_OVERFLOW )
+		{
+			/* some chars were lost while receiving */
+			pt_uart_send(&Driver_UART0, &tx, "overflow\n\r", 10);
+			PT_AWAIT(pt, &tx);
+		}
+
+		PT_DELAY_MS(pt, t, 100);	// little delay so user can see the LED was on
+		msf_pin_write(BLUE_LED, true);		// turn LED off
+	}
+
+	PT_END(pt);
+}
+
+/* blink_thread
+ * Blinks the red LED; the period is given by the voltage on the analog input.
+ */
+PT_THREAD(blink_thread(PT* pt))
+{
+	static PT_OP adc;
+	static uint32_t t;
+
+	PT_BEGIN(pt);
+
+	while (1)
+	{
+		pt_adc_start(&adc, MSF_PIN2CHANNEL(BLINK_INPUT));
+		PT_AWAIT(pt, &adc);
+
+		/* 12-bit result 0 - 4095 gives half period 50 - 562 ms */
+		msf_pin_toggle(RED_LED);
+		PT_DELAY_MS(pt, t, 50 + (adc.result >> 3));
+	}
+
+	PT_END(pt);
+}
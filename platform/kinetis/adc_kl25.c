@@ -28,15 +28,33 @@ static ADC_INFO ADC0_Info;
 /* UART0 Resources */
 static ADC_RESOURCES ADC0_Resources = {
   ADC0,    /* ADC type object defined in CMSIS <device.h>*/
-  &ADC0_Info
+  &ADC0_Info,
+  ADC0_IRQn
 };
 
 #endif /* MSF_DRIVER_ADC0 */
 
 
+/* ADC channel of the bandgap reference; it needs the buffer in PMC to be enabled */
+#define		ADC_CHANNEL_BANDGAP		(27)
+
 /* Prototypes */
 static void adcx_init(ADC_RESOURCES* adc);	  
 static uint32_t adcx_calibrate(ADC_RESOURCES* adc);
+static void adcx_calib_get(ADC_RESOURCES* adc, MSF_ADC_CALIB* calib);
+static uint32_t adcx_calib_set(ADC_RESOURCES* adc, const MSF_ADC_CALIB* calib);
+static uint16_t adcx_calib_checksum(const MSF_ADC_CALIB* calib);
+static void adcx_enable_int(ADC_RESOURCES* adc, uint32_t enable);
+#if MSF_CLOCK_SWITCH
+static uint32_t adcx_prescaler(void);
+#if (MSF_DRIVER_ADC0)
+static uint8_t adc0_clock_changed(uint32_t bus_clock, bool check);
+#endif
+	/* The prescaler depends on the current bus clock */
+	#define	ADC_PRESCALER	adcx_prescaler()
+#else
+	#define	ADC_PRESCALER	WMSF_ADC_PRESCALER
+#endif
 
         
 /* The driver API functions */
@@ -52,8 +70,9 @@ static uint32_t adcx_calibrate(ADC_RESOURCES* adc);
 */
 static uint32_t  ADC_Initialize( MSF_ADC_Event_t event,  ADC_RESOURCES* adc)
 {
-    adc->info->cb_event = event;	/* store pointer to user callback; not used for now */
+    adc->info->cb_event = event;	/* store pointer to user callback */
     adc->info->channel = 0;
+    adc->info->status = 0;
     
     /* Enable clock for ADC0 */
     /* Note: if modifying for MCUs with ADC1, need to update this code! */
@@ -62,14 +81,21 @@ static uint32_t  ADC_Initialize( MSF_ADC_Event_t event,  ADC_RESOURCES* adc)
     /* init the given ADC */
     adcx_init(adc);
     
-    /* calibrate the ADC */
-    adcx_calibrate(adc);
+    /* Restore the calibration from stored data, if available and valid.
+     * Otherwise calibrate the ADC */
+    if ( adcx_calib_set(adc, (const MSF_ADC_CALIB*)WMSF_ADC_CALIB_ADDRESS) != MSF_ERROR_OK )
+    {
+    	adcx_calibrate(adc);
  
-    /* re-init the ADC. 
-     Needed because the calibration changes some values */
-    adcx_init(adc);
+    	/* re-init the ADC. 
+     	 Needed because the calibration changes some values */
+    	adcx_init(adc);
+    }
   
-
+#if MSF_LOWPOWER
+    /* full power; the ADC needs the bus clock */
+    msf_lowpower_vote(MSF_LP_ADC0, msf_sleep_wait);
+#endif
     return MSF_ERROR_OK;
 }
 
@@ -77,6 +103,10 @@ static uint32_t  ADC_Initialize( MSF_ADC_Event_t event,  ADC_RESOURCES* adc)
 /* Instance specific function pointed-to from the driver access struct */
 static uint32_t ADC0_Initialize (MSF_ADC_Event_t pEvent) 
 {
+#if MSF_CLOCK_SWITCH
+  /* the bus clock can change; set the prescaler again then */
+  msf_clock_notify_add(adc0_clock_changed);
+#endif
   return ADC_Initialize(pEvent, &ADC0_Resources);
 }
 #endif
@@ -96,9 +126,17 @@ static int32_t UART1_Initialize (UART_Event_t pEvent) {
 */
 static uint32_t  ADC_Uninitialize( ADC_RESOURCES* adc)
 {
-    /* TODO: reset internal state for this instance of the ADC */
+	/* stop any conversion and disable the interrupt */
+	adc->reg->SC1[0] =  ADC_SC1_ADCH(AIN_ADC_DISALED);
+	adcx_enable_int(adc, 0);
+	
     adc->info->cb_event = null;
     adc->info->channel = 0;
+    adc->info->status = 0;
+#if MSF_LOWPOWER
+    /* not used; does not limit the stop modes */
+    msf_lowpower_vote(MSF_LP_ADC0, msf_sleep_lls);
+#endif
     return MSF_ERROR_OK;
 }
 
@@ -106,22 +144,55 @@ static uint32_t  ADC_Uninitialize( ADC_RESOURCES* adc)
 /* Instance specific function pointed-to from the driver access struct */
 static uint32_t ADC0_Uninitialize (void) 
 {
+#if MSF_CLOCK_SWITCH
+  msf_clock_notify_remove(adc0_clock_changed);
+#endif
   return ADC_Uninitialize(&ADC0_Resources);
 }
 #endif
 
 
 /**
-  \brief       Initialize ADC Interface.
+  \brief       Change the power mode of the ADC.
   \param[in]   state  The requested power state
   \param[in]   adc    Pointer to adc resources
   \return      error code (0 = OK)
-  \note        Currently does nothing!
-               Note that the ADC automatically enters low power mode after conversion, see datasheet.
+  \note        Note that the ADC automatically enters low power mode after conversion, see datasheet.
+  	  msf_power_off and msf_power_low: the conversion in progress is stopped and the clock of the ADC
+  	  	  is disabled. The ADC uses the bus clock, so it cannot convert in the stop modes anyway.
+  	  	  Do not call other functions of the driver until the power is set to full again. 
+  	  msf_power_full: normal operation; the settings and the calibration are kept.
 */
 static uint32_t ADC_PowerControl(MSF_power_state state, ADC_RESOURCES* adc)
 {
-    return MSF_ERROR_NOTSUPPORTED;
+	switch ( state )
+	{
+	case msf_power_off:
+	case msf_power_low:
+		if ( (SIM->SCGC6 & SIM_SCGC6_ADC0_MASK) == 0 )
+			return MSF_ERROR_OK;	/* already off */
+		/* stop any conversion */
+		adc->reg->SC1[0] =  ADC_SC1_ADCH(AIN_ADC_DISALED);
+		adc->info->status = 0;
+		/* Note: if modifying for MCUs with ADC1, need to update this code! */
+		SIM->SCGC6 &= ~SIM_SCGC6_ADC0_MASK;
+#if MSF_LOWPOWER
+		msf_lowpower_vote(MSF_LP_ADC0, msf_sleep_lls);
+#endif
+		break;
+		
+	case msf_power_full:
+		SIM->SCGC6 |= SIM_SCGC6_ADC0_MASK;
+#if MSF_LOWPOWER
+		msf_lowpower_vote(MSF_LP_ADC0, msf_sleep_wait);
+#endif
+		break;
+		
+	default:
+		return MSF_ERROR_ARGUMENT;
+	}
+	
+	return MSF_ERROR_OK;
 } 
 
 #if (MSF_DRIVER_ADC0)    
@@ -143,14 +214,35 @@ static uint32_t ADC0_PowerControl(MSF_power_state state)
 */
 static uint32_t ADC_Control(uint32_t control, uint32_t arg, ADC_RESOURCES* adc)
 {
-	uint32_t tmp;
+	uint32_t tmp, tmp2;
 	
 	/* Disable the ADC before changing parameters by writing all 1s to channel
 	 * It will be re-enabled when Read is called.
+	 * Note that this also aborts oversampling in progress.
 	 */
 	adc->reg->SC1[0] =  ADC_SC1_ADCH(AIN_ADC_DISALED);
+	if ( adc->info->status & ADC_STATUS_OVERSAMPLE )
+	{
+		adc->info->status &= ~ADC_STATUS_OVERSAMPLE;
+		if ( adc->info->status & ADC_STATUS_RESTORE_SINGLE )
+			adc->reg->SC3 &= ~ADC_SC3_ADCO_MASK;
+		if ( (adc->info->status & ADC_STATUS_INT_MODE) == 0 )
+			adcx_enable_int(adc, 0);
+	}
 	
 	
+	/* Callback; set first so that it can be given together with the interrupt mode */
+	if ( (control & MSF_ADC_EVENT_SET_Mask) != 0 )
+	{
+		adc->info->cb_event = (MSF_ADC_Event_t)arg;
+		if ( adc->info->cb_event == null && (adc->info->status & ADC_STATUS_INT_MODE) )
+		{
+			/* no one to pass the result to */
+			adc->info->status &= ~ADC_STATUS_INT_MODE;
+			adcx_enable_int(adc, 0);
+		}
+	}
+	
 	/* Single or continuous conversion  */
 	if ( (control & MSF_ADC_CONV_Mask) != 0 )
 	{
@@ -167,7 +259,22 @@ static uint32_t ADC_Control(uint32_t control, uint32_t arg, ADC_RESOURCES* adc)
 	}
 	
 	/* Polled or interrupt mode */
-	/* TODO: implement */
+	if ( (control & MSF_ADC_MODE_Mask) != 0 )
+	{
+		if ( (control & MSF_ADC_MODE_Mask) == MSF_ADC_MODE_INT )
+		{
+			/* The result is passed to the callback, so it must exist */
+			if ( adc->info->cb_event == null )
+				return MSF_ERROR_CONFIG;
+			adc->info->status |= ADC_STATUS_INT_MODE;
+			adcx_enable_int(adc, 1);
+		}
+		else
+		{
+			adc->info->status &= ~ADC_STATUS_INT_MODE;
+			adcx_enable_int(adc, 0);
+		}
+	}
 	
 	
 	/* Change resolution */	
@@ -175,7 +282,7 @@ static uint32_t ADC_Control(uint32_t control, uint32_t arg, ADC_RESOURCES* adc)
 	{
 		tmp = ((control & MSF_ADC_RES_Mask) >> MSF_ADC_RES_Pos) - 1;	/* the value which means resolution */
 		adc->reg->CFG1 &= ~ADC_CFG1_MODE_MASK;	/* clear the bits in register */
-		adc->reg->CFG1 = ADC_CFG1_MODE(tmp);	/* now set the new resolution */
+		adc->reg->CFG1 |= ADC_CFG1_MODE(tmp);	/* now set the new resolution */
 	}
 	
 	
@@ -232,6 +339,64 @@ static uint32_t ADC_Control(uint32_t control, uint32_t arg, ADC_RESOURCES* adc)
 		}
 	}	
 	
+	/* Calibration */
+	if ( (control & MSF_ADC_CALIB_Mask) != 0)
+	{
+		switch ( control & MSF_ADC_CALIB_Mask )
+		{
+		case MSF_ADC_CALIB_RUN:
+			/* The calibration changes SC2 and SC3; keep the user settings */
+			tmp = adc->reg->SC2;
+			tmp2 = adc->reg->SC3;
+			if ( adcx_calibrate(adc) != 0 )
+				return MSF_ERROR_UNKNOWN;
+			adc->reg->SC2 = tmp;
+			adc->reg->SC3 = tmp2 & ~ADC_SC3_CALF_MASK;
+			break;
+			
+		case MSF_ADC_CALIB_GET:
+			if ( arg == 0 )
+				return MSF_ERROR_ARGUMENT;
+			adcx_calib_get(adc, (MSF_ADC_CALIB*)arg);
+			break;
+			
+		case MSF_ADC_CALIB_SET:
+			return adcx_calib_set(adc, (const MSF_ADC_CALIB*)arg);
+		}
+	}
+	
+	/* Oversampling. 
+	 * Abort is done already by disabling the ADC above. */
+	if ( (control & MSF_ADC_OVERSAMPLE_Mask) == MSF_ADC_OVERSAMPLE_START )
+	{
+		if ( arg < 1 || arg > MSF_ADC_OVERSAMPLE_MAX_BITS )
+			return MSF_ERROR_ARGUMENT;
+		if ( adc->info->cb_event == null )
+			return MSF_ERROR_CONFIG;
+		
+		adc->info->acc = 0;
+		adc->info->count = 1UL << (2 * arg);	/* 4^N samples */
+		adc->info->ovs_bits = (uint8_t)arg;
+		adc->info->status |= ADC_STATUS_OVERSAMPLE;
+		
+		/* Use continuous conversions, the ISR takes the samples */
+		if ( adc->reg->SC3 & ADC_SC3_ADCO_MASK )
+			adc->info->status &= ~ADC_STATUS_RESTORE_SINGLE;
+		else
+		{
+			adc->info->status |= ADC_STATUS_RESTORE_SINGLE;
+			adc->reg->SC3 |= ADC_SC3_ADCO_MASK;
+		}
+		adcx_enable_int(adc, 1);
+		
+		/* Start the conversions */
+		tmp = adc->reg->SC1[0];
+		tmp &= ~(ADC_SC1_ADCH_MASK | ADC_SC1_DIFF_MASK);
+		tmp |= ADC_SC1_AIEN_MASK | ADC_SC1_ADCH(adc->info->channel) 
+				| (adc->info->channel & MSF_ADC_CHANNEL_DIFF);
+		adc->reg->SC1[0] = tmp;
+	}
+	
     return MSF_ERROR_OK;
 }
 
@@ -248,21 +413,37 @@ static uint32_t ADC0_Control(uint32_t control, uint32_t arg)
   \brief       Read data from ADC; from current channel.  
   \param[in]   adc    Pointer to ADC resources
   \return      The value from ADC converter or 0xFFFFFFFF on error.
+  	  	  	  In interrupt mode returns 0; the value is passed to the callback. 
   \note        Common function called by instance-specific function.
             Only 16-bits in the return value or less are used depending on ADC configuration
 */
 static uint32_t ADC_Read(ADC_RESOURCES* adc)
 {	
 	uint32_t tmp;
+	
+	/* The ADC is busy with oversampling */
+	if ( adc->info->status & ADC_STATUS_OVERSAMPLE )
+		return MSF_ERROR_MAXDWORD;
+	
 	/* Write the channel to SC1A (SC1[0] register to start a conversion 
 	 * Note that SC1B cannot be used for SW triggered operation and write to 
 	 * SC1B does not start new conversion! */
-	if ( adc->info->channel < 31 )
+	if ( (adc->info->channel & ~MSF_ADC_CHANNEL_DIFF) < 31 )
 	{
 		tmp = adc->reg->SC1[0];
-		tmp &= ~(ADC_SC1_ADCH_MASK << ADC_SC1_ADCH_SHIFT);	// set channel to 0, keep other values
+		tmp &= ~((ADC_SC1_ADCH_MASK << ADC_SC1_ADCH_SHIFT) | ADC_SC1_DIFF_MASK);	// set channel to 0, keep other values
 		tmp |= ADC_SC1_ADCH(adc->info->channel);	// select the channel
-		adc->reg->SC1[0] =  tmp;
+		/* MSF_ADC_CHANNEL_DIFF has the same value as the DIFF bit in SC1 */ 
+		tmp |= (adc->info->channel & MSF_ADC_CHANNEL_DIFF);
+		
+		if ( adc->info->status & ADC_STATUS_INT_MODE )
+		{
+			/* just start the conversion; the ISR will report the result */
+			adc->reg->SC1[0] = tmp | ADC_SC1_AIEN_MASK;
+			return 0;
+		}
+		
+		adc->reg->SC1[0] =  tmp & ~ADC_SC1_AIEN_MASK;
 		
 		/* wait for conversion to complete */
 		while ( !WMSF_ADCA_COMPLETE(adc->reg) ) ; 
@@ -288,9 +469,12 @@ static uint32_t ADC0_Read(void)
   \param[in]   adc    Pointer to ADC resources 
   \return      Error code; 0 = OK
   \note        Common function called by instance-specific function.
-  	  	  	  The channel number must be the direct value which will be used in the ADC register.
+  	  	  	  The channel number must be the direct value which will be used in the ADC register,
+  	  	  	  optionally with MSF_ADC_CHANNEL_DIFF flag to select differential mode.
   	  	  	  The caller must make sure the channel is valid, see enum in msf_<device>.h for 
   	  	  	  valid channel definitions.
+  	  	  	  If the bandgap channel is selected, the bandgap buffer is enabled. It is not 
+  	  	  	  disabled automatically.
 */
 static uint32_t  ADC_SetChannel( uint32_t channel, ADC_RESOURCES* adc)
 {     
@@ -299,8 +483,12 @@ static uint32_t  ADC_SetChannel( uint32_t channel, ADC_RESOURCES* adc)
 	/* The driver does not set the pins for analog input. This it default
   		function for the pin so this is in general not needed. If it is needed,
   		the user should set the appropriate pin.   */
-	if ( channel < 31 )
+	if ( (channel & ~MSF_ADC_CHANNEL_DIFF) < 31 )
 	{
+		/* The bandgap can be measured only if the buffer is enabled */
+		if ( (channel & ~MSF_ADC_CHANNEL_DIFF) == ADC_CHANNEL_BANDGAP )
+			PMC->REGSC |= PMC_REGSC_BGBE_MASK;
+		
 		/* just store the channel into our resources; */
 		adc->info->channel = (uint8_t)channel;
 		return MSF_ERROR_OK; 
@@ -333,6 +521,50 @@ MSF_DRIVER_ADC Driver_ADC0 = {
 
 #endif	/* MSF_DRIVER_ADC0 */
 
+/** Interrupt handler for all ADC instances */
+void ADC_IRQHandler(ADC_RESOURCES* adc)
+{
+	uint32_t value;
+	ADC_INFO* info = adc->info;
+	
+	if ( !WMSF_ADCA_COMPLETE(adc->reg) )
+		return;
+	
+	value = adc->reg->R[0];	/* reading the result also clears COCO flag */
+	
+	if ( info->status & ADC_STATUS_OVERSAMPLE )
+	{
+		info->acc += value;
+		if ( --info->count == 0 )
+		{
+			/* all samples taken; stop the conversions */
+			adc->reg->SC1[0] =  ADC_SC1_ADCH(AIN_ADC_DISALED);
+			if ( info->status & ADC_STATUS_RESTORE_SINGLE )
+				adc->reg->SC3 &= ~ADC_SC3_ADCO_MASK;
+			info->status &= ~ADC_STATUS_OVERSAMPLE;
+			if ( (info->status & ADC_STATUS_INT_MODE) == 0 )
+				adcx_enable_int(adc, 0);
+			
+			/* sum of 4^N samples divided by 2^N gives N extra bits */
+			if ( info->cb_event )
+				info->cb_event(MSF_ADC_EVENT_OVERSAMPLE_COMPLETE, info->acc >> info->ovs_bits);
+		}
+	}
+	else
+	{
+		if ( info->cb_event )
+			info->cb_event(MSF_ADC_EVENT_CONV_COMPLETE, value);
+	}
+}
+
+/* Interrupt handler for ADC0 */
+#if (MSF_DRIVER_ADC0)
+void ADC0_IRQHandler(void)
+{
+	ADC_IRQHandler(&ADC0_Resources);
+}
+#endif /* MSF_DRIVER_ADC0 */
+
 /*========================  Internal functions ========================== */
 static void adcx_init(ADC_RESOURCES* adc)
 {
@@ -346,7 +578,7 @@ static void adcx_init(ADC_RESOURCES* adc)
 	/*adc->reg->SC1 |= (ADC_SC1_AIEN_MASK << ADC_SC1_AIEN_SHIFT); */ /* enable interrupt */
 	
 	/* Select ADC clock, prescaler and resolution  */
-	adc->reg->CFG1 = ADC_CFG1_ADICLK(WMSF_ADC_CLOCK) | ADC_CFG1_ADIV(WMSF_ADC_PRESCALER) 
+	adc->reg->CFG1 = ADC_CFG1_ADICLK(WMSF_ADC_CLOCK) | ADC_CFG1_ADIV(ADC_PRESCALER) 
 			| ADC_CFG1_MODE(WMSF_ADC_RESOLUTION);
 	
 	/* ADC A or B, long sample time selection */
@@ -363,6 +595,34 @@ static void adcx_init(ADC_RESOURCES* adc)
 		adc->reg->SC3 = 0;	/* default values, no averaging */
 }
   
+#if MSF_CLOCK_SWITCH
+/* Get the prescaler (ADIV value) for the current bus clock, so that the ADC clock
+ * is at most 4 MHz as with the WMSF_ADC_PRESCALER values for fixed F_CPU.
+ * 24 MHz bus: 3 (3 MHz); 8 MHz: 1 (4 MHz); 4 MHz: 0 (4 MHz) */
+static uint32_t adcx_prescaler(void)
+{
+	uint32_t adiv = 0;
+	uint32_t bus_clock = msf_clock_bus();
+	
+	while ( adiv < 3 && (bus_clock >> adiv) > 4000000u )
+		adiv++;
+	return adiv;
+}
+
+#if (MSF_DRIVER_ADC0)
+/* Called by msf_clock_set before and after the bus clock changed; the ADC works with any 
+ * of the clocks. The calibration does not need to be repeated; the ADC clock stays about the same */
+static uint8_t adc0_clock_changed(uint32_t bus_clock, bool check)
+{
+	if ( check || (SIM->SCGC6 & SIM_SCGC6_ADC0_MASK) == 0 )
+		return MSF_ERROR_OK;	/* if the ADC is off, the prescaler is set when the power is set to full */
+	ADC0_Resources.reg->CFG1 = (ADC0_Resources.reg->CFG1 & ~ADC_CFG1_ADIV_MASK) 
+			| ADC_CFG1_ADIV(adcx_prescaler());
+	return MSF_ERROR_OK;
+}
+#endif
+#endif	/* MSF_CLOCK_SWITCH */
+
 /* Calibrate the ADC 
  * From FRDM-KL25Z sample code 
  * return 0 on success; 1 on error */
@@ -423,6 +683,95 @@ static uint32_t adcx_calibrate(ADC_RESOURCES* adc)
 
 	  return 0;
 }
+
+/* Copy the current calibration values from ADC registers to the calib structure.
+ * Note that CLPx and CLMx registers are placed next to each other in the ADC 
+ * register map (CLPD thru CLP0 and CLMD thru CLM0) */
+static void adcx_calib_get(ADC_RESOURCES* adc, MSF_ADC_CALIB* calib)
+{
+	volatile uint32_t* clp = &adc->reg->CLPD;
+	volatile uint32_t* clm = &adc->reg->CLMD;
+	uint32_t i;
+	
+	calib->magic = MSF_ADC_CALIB_MAGIC;
+	calib->config = (uint16_t)(adc->reg->CFG1 & (ADC_CFG1_ADICLK_MASK | ADC_CFG1_ADIV_MASK | ADC_CFG1_ADLPC_MASK));
+	calib->ofs = (uint16_t)adc->reg->OFS;
+	calib->pg = (uint16_t)adc->reg->PG;
+	calib->mg = (uint16_t)adc->reg->MG;
+	for ( i=0; i<7; i++ )
+	{
+		calib->clp[i] = (uint16_t)clp[i];
+		calib->clm[i] = (uint16_t)clm[i];
+	}
+	calib->checksum = adcx_calib_checksum(calib);
+}
+
+/* Write the calibration values from calib structure to the ADC registers. 
+ * The data are checked first and not used if they are not valid.
+ * return MSF_ERROR_OK if the calibration was restored; MSF_ERROR_ARGUMENT if the 
+ * data are not valid. */
+static uint32_t adcx_calib_set(ADC_RESOURCES* adc, const MSF_ADC_CALIB* calib)
+{
+	volatile uint32_t* clp = &adc->reg->CLPD;
+	volatile uint32_t* clm = &adc->reg->CLMD;
+	uint32_t i;
+	
+	if ( calib == null )
+		return MSF_ERROR_ARGUMENT;
+	
+	/* Quick check: erased flash or other data than calibration record */
+	if ( calib->magic != MSF_ADC_CALIB_MAGIC || calib->checksum != adcx_calib_checksum(calib) )
+		return MSF_ERROR_ARGUMENT;
+	
+	/* The calibration is valid only for the ADC clock it was obtained with */
+	if ( calib->config != (adc->reg->CFG1 & (ADC_CFG1_ADICLK_MASK | ADC_CFG1_ADIV_MASK | ADC_CFG1_ADLPC_MASK)) )
+		return MSF_ERROR_ARGUMENT;
+	
+	/* The gain values always have the MSB set after calibration (see adcx_calibrate) */
+	if ( (calib->pg & 0x8000) == 0 || (calib->mg & 0x8000) == 0 )
+		return MSF_ERROR_ARGUMENT;
+	
+	adc->reg->OFS = calib->ofs;
+	adc->reg->PG = calib->pg;
+	adc->reg->MG = calib->mg;
+	for ( i=0; i<7; i++ )
+	{
+		clp[i] = calib->clp[i];
+		clm[i] = calib->clm[i];
+	}
+	
+	return MSF_ERROR_OK;
+}
+
+/* Compute the checksum of the calibration data - inverted 16-bit sum of all the 
+ * members except the checksum itself. Inverted so that erased flash (all 0xFFFF) 
+ * or zeroed memory does not look valid. */
+static uint16_t adcx_calib_checksum(const MSF_ADC_CALIB* calib)
+{
+	const uint16_t* p = (const uint16_t*)calib;
+	uint16_t sum = 0;
+	
+	while ( p < &calib->checksum )
+		sum += *p++;
+	
+	return (uint16_t)~sum;
+}
+
+/* Enable or disable the ADC interrupt in NVIC */
+static void adcx_enable_int(ADC_RESOURCES* adc, uint32_t enable)
+{
+	if ( enable )
+	{
+		NVIC_ClearPendingIRQ(adc->irqn);	/* Clear possibly pending interrupt */
+		NVIC_EnableIRQ(adc->irqn);			/* and enable it */	
+		/* Set priority for the interrupt; 0 is highest, 3 is lowest */
+		NVIC_SetPriority(adc->irqn, MSF_ADC_INT_PRIORITY);					
+	}
+	else
+	{
+		NVIC_DisableIRQ(adc->irqn);	
+	}
+}
     	
 /**@}*/
 
@@ -16,9 +16,6 @@
  * 			of conversions.
  * 			The ADC goes to low power mode after conversion automatically. 
  * 	TODO: PowerControl
- * 	TODO: Control option to run calibration
- * 	TODO: interrupt on COCO mode
- * 	TODO: Continuous conversion mode
  *
  ******************************************************************************/
 #ifndef MSF_ADC_K25_H
@@ -41,11 +38,19 @@ extern "C" {
  * @{ 
 */
 
+/* Internal status flags for ADC_INFO.status */
+#define		ADC_STATUS_INT_MODE			(1UL << 0)	/* interrupt mode; Read only starts the conversion */
+#define		ADC_STATUS_OVERSAMPLE		(1UL << 1)	/* oversampling in progress */
+#define		ADC_STATUS_RESTORE_SINGLE	(1UL << 2)	/* switch back to single conversion after oversampling */
+
 /* ADC Run-time information*/
 typedef struct _ADC_INFO {
   MSF_ADC_Event_t cb_event;          // Event Callback
-  uint32_t      status;               // Status flags - not used yet.
+  uint32_t      status;               // Status flags, see ADC_STATUS_...
+  uint32_t      acc;			/* sum of the samples for oversampling */
+  uint32_t      count;			/* samples remaining for oversampling */
   uint8_t       channel;        /* Current channel */     
+  uint8_t       ovs_bits;		/* extra bits for oversampling */
 } ADC_INFO;
 
 
@@ -57,6 +62,7 @@ there could be 1 or 2 instances of UART driver for UART1 and UART2. */
 typedef struct {
         ADC_Type  *reg;  // ADC peripheral register interface, CMSIS        
         ADC_INFO   *info;   // Run-Time information
+        IRQn_Type	irqn;	// interrupt number in NVIC
 } const ADC_RESOURCES;
 
 
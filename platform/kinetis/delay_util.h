@@ -1,10 +1,12 @@
 /****************************************************************************
  * @file     delay_util.h
- * @brief    busy-loop delays for Kinetis MCUs 
+ * @brief    busy-loop delays for Kinetis MCUs
  * @version  1
  * @date     6. May 2014
  *
  * @note     This file is included into msf.h.
+ *           The delay loops are generated at compile time from F_CPU, so they are
+ *           available for any CPU clock.
  *
  ******************************************************************************/
 #ifndef MSF_DELAY_UTIL_H
@@ -15,210 +17,95 @@
 extern "C" {
 #endif
 
-/** @addtogroup group_globals  
-* @{ 
+/** @addtogroup group_globals
+* @{
 */
 
-/** Convenience inline functions for very short busy-loop waiting
- * IMPORTANT: the results will be incorrect if compiler optimizations are not enabled.
- * For example, the inline functions are not "inlined" but called which results in longer delays.
-*/
-#if		F_CPU == 4000000
-    /* 1 clock is 1/4 us */
-    /** Delay for 1 us
-     * always_inline attribute makes sure it is inlined even if optimisations are off or Os (for size)
-     */
-	static inline void MSF_DELAY_1US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_1US(void)
-    {
-        // Need 4 clocks
-        __asm__ __volatile__ (
-				"PUSH {r0} " "\n\t"			// 2 clocks
-				"POP {r0} " "\n\t"			// 2 clocks
-		);
-    }
+/** Number of CPU clock cycles for given number of microseconds (rounded); compile-time constant */
+#define	MSF_US_TO_CYCLES(us)	((uint32_t)(((uint64_t)(us) * F_CPU + 500000) / 1000000))
+
+/** @brief Wait exactly n CPU clock cycles.
+ * @param n number of cycles; must be compile-time constant, 0 thru 50 000 000.
+ * @details The code is generated by the assembler from n:
+ * n < 4: n NOPs;
+ * otherwise a loop of 3 cycles per pass, preceded by loading the counter (1, 3 or 5 cycles
+ * depending on the size of n) and followed by 0 - 2 NOPs for the remainder.
+ * The loop takes 3 * N - 1 cycles for N passes (the last branch is not taken).
+ * The timing assumes the code runs without wait states; see msf_delay_selftest.
+ * Interrupts which occur during the delay make it longer.
+ */
+#define msf_delay_cycles(n)		do { \
+		uint32_t wmsf_delay_tmp_; \
+		__asm__ __volatile__ ( \
+			".if (%c1) < 4" "\n\t" \
+			".rept (%c1)" "\n\t" \
+			"NOP" "\n\t" \
+			".endr" "\n\t" \
+			".elseif (%c1) < 768" "\n\t" \
+			"MOV %0, #((%c1) / 3)" "\n\t"	/* 1 clock */ \
+			"1: SUB %0, #1" "\n\t"			/* 1 clock */ \
+			"BNE 1b" "\n\t"					/* 2 clocks if branches, 1 if not */ \
+			".rept ((%c1) - 3 * ((%c1) / 3))" "\n\t" \
+			"NOP" "\n\t" \
+			".endr" "\n\t" \
+			".elseif (%c1) < 196610" "\n\t" \
+			"MOV %0, #((((%c1) - 2) / 3) >> 8)" "\n\t"		/* 3 clocks to load 16-bit count */ \
+			"LSL %0, #8" "\n\t" \
+			"ADD %0, #((((%c1) - 2) / 3) & 0xff)" "\n\t" \
+			"1: SUB %0, #1" "\n\t" \
+			"BNE 1b" "\n\t" \
+			".rept ((%c1) - 2 - 3 * (((%c1) - 2) / 3))" "\n\t" \
+			"NOP" "\n\t" \
+			".endr" "\n\t" \
+			".elseif (%c1) < 50331652" "\n\t" \
+			"MOV %0, #((((%c1) - 4) / 3) >> 16)" "\n\t"		/* 5 clocks to load 24-bit count */ \
+			"LSL %0, #8" "\n\t" \
+			"ADD %0, #(((((%c1) - 4) / 3) >> 8) & 0xff)" "\n\t" \
+			"LSL %0, #8" "\n\t" \
+			"ADD %0, #((((%c1) - 4) / 3) & 0xff)" "\n\t" \
+			"1: SUB %0, #1" "\n\t" \
+			"BNE 1b" "\n\t" \
+			".rept ((%c1) - 4 - 3 * (((%c1) - 4) / 3))" "\n\t" \
+			"NOP" "\n\t" \
+			".endr" "\n\t" \
+			".else" "\n\t" \
+			".error \"msf_delay_cycles: too many cycles; use msf_delay_us\"" "\n\t" \
+			".endif" \
+			: "=&l" (wmsf_delay_tmp_) \
+			: "i" (n) \
+			: "cc"); \
+	} while (0)
+
+/** @brief Wait given number of microseconds; us must be compile-time constant.
+ * The number of cycles is rounded to the nearest integer, so the error is at most
+ * half of the CPU clock cycle.
+ */
+#define	MSF_DELAY_US(us)		msf_delay_cycles(MSF_US_TO_CYCLES(us))
 
-    /** Delay for 5 us
-     */
-    static inline void MSF_DELAY_5US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_5US(void)
-    {
-        // need 20 clocks
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-    	// 3 * 5 - 1 = 14 + 5 = 19 + 1 nop to get 20
-         __asm__ __volatile__ (
-			"PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#5" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not; 1b means local label backwards
-			"POP {r0}"              // 2 clocks
-        	"NOP" "\n\t"     		// 1 clock
-		);
-    }
+/** Convenience inline functions for very short busy-loop waiting
+ * always_inline attribute makes sure they are inlined even if optimisations are off or Os (for size)
+ */
+/** Delay for 1 us */
+static inline void MSF_DELAY_1US(void) __attribute__((always_inline, unused));
+static inline void MSF_DELAY_1US(void)
+{
+	MSF_DELAY_US(1);
+}
 
-#elif     F_CPU == 8000000
-    /* 1 clock is 1/8 us */ 
-    /** Delay for 1 us
-     * always_inline attribute makes sure it is inlined even if optimisations are off or Os (for size)
-     */  
-	static inline void MSF_DELAY_1US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_1US(void)
-    {        
-        // Need 8 clocks
-        __asm__ __volatile__ (				
-				"PUSH {r0} " "\n\t"			// 2 clocks
-				"POP {r0} " "\n\t"			// 2 clocks
-                "PUSH {r0} " "\n\t"			// 2 clocks 
-				"POP {r0} " "\n\t"			// 2 clocks                
-		);
-    }
-    
-    /** Delay for 5 us
-     */ 
-    static inline void MSF_DELAY_5US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_5US(void)
-    {       
-        // need 40 clocks
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-    	// 3 * 12 - 1 = 35 + 5 = 40
-         __asm__ __volatile__ (				
-			"PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#12" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not; 1b means local label backwards
-			"POP {r0}"              // 2 clocks			
-		);
-    }
+/** Delay for 5 us */
+static inline void MSF_DELAY_5US(void) __attribute__((always_inline, unused));
+static inline void MSF_DELAY_5US(void)
+{
+	MSF_DELAY_US(5);
+}
 
-#elif   ((F_CPU == 20900000) || (F_CPU == 20970000))
-    /** Delay for 1 us
-     */  
-    static inline void MSF_DELAY_1US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_1US(void)
-    {     
-        // Need 21 clocks   
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-        // 3 * 5 -1 = 14 + 5 = 19 -> add 2 nops
-         __asm__ __volatile__ (				
-			"NOP" "\n\t"     // 1 clock
-            "NOP" "\n\t"	
-            "PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#5" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not
-			"POP {r0}"              // 2 clocks			
-		);
-    }
-    
-    /** Delay for 5 us
-     */ 
-    static inline void MSF_DELAY_5US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_5US(void)
-    {     
-        // Need 104.5 clocks   
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-        // 3 * 33  -1 = 98 + 5 = 103 -> add 2 nops
-         __asm__ __volatile__ (				
-			"NOP" "\n\t"     // 1 clock
-            "NOP" "\n\t"	
-            "PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#33" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not
-			"POP {r0}"              // 2 clocks			
-		);
-    }
+/** Delay for 10 us */
+static inline void MSF_DELAY_10US(void) __attribute__((always_inline, unused));
+static inline void MSF_DELAY_10US(void)
+{
+	MSF_DELAY_US(10);
+}
 
-#elif  F_CPU == 41943040
-    
-    /** Delay for 1 us
-     */ 
-    static inline void MSF_DELAY_1US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_1US(void)
-    {     
-        // Need 42 clocks   
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-        // 3 * 12 -1 = 35 + 5 = 40 -> add 2 nops
-         __asm__ __volatile__ (				
-			"NOP" "\n\t"     // 1 clock
-            "NOP" "\n\t"	
-            "PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#12" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not
-			"POP {r0}"              // 2 clocks			
-		);
-    }
-    
-     /** Delay for 5 us
-     */
-    static inline void MSF_DELAY_5US(void) __attribute__((always_inline, unused));
-    static inline void MSF_DELAY_5US(void)
-    {     
-        // Need 210 clocks   
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-        // 3 * 68  -1 = 203 + 5 = 208 -> add 2 nops
-         __asm__ __volatile__ (				
-			"NOP" "\n\t"     // 1 clock
-            "NOP" "\n\t"	
-            "PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#68" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not
-			"POP {r0}"              // 2 clocks			
-		);
-    }
-    
-#elif  F_CPU == 48000000
-     
-    /** Delay for 1 us
-     */    
-    static inline void MSF_DELAY_1US(void) __attribute__((always_inline));
-    static inline void MSF_DELAY_1US(void)
-    {     
-        // Need 48 clocks   
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-        // 3 * 14 -1 = 41 + 5 = 46 -> add 2 nops
-         __asm__ __volatile__ (				
-			"NOP" "\n\t"     // 1 clock
-            "NOP" "\n\t"	
-            "PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#14" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not
-			"POP {r0}"              // 2 clocks			
-		);
-    }
-    
-    /** Delay for 5 us
-     */  
-    static inline void MSF_DELAY_5US(void) __attribute__((always_inline));
-    static inline void MSF_DELAY_5US(void)
-    {       
-        // need 240 clocks
-        // For N repetitions the loop takes 3*N-1 clocks
-        // plus 5 clocks the other code;
-        // 3*78 = 234 + 5 = 239 -> add 1 nop
-         __asm__ __volatile__ (	
-         	"NOP" "\n\t"     // 1 clock			
-			"PUSH {r0}" "\n\t"			// 2 clocks
-            "MOV r0,#78" "\n\t"         // 1 clock
-            "1: SUB r0, #1" "\n\t"	// 1 clock
-			"BNE 1b"  "\n\t"		// 2 clocks if branches, 1 if not
-			"POP {r0}"              // 2 clocks			
-		);
-    }
-      
-#else
-    #warning Short delay functions not defined for current F_CPU. 
-#endif 
 /** @}*/
 
 #ifdef __cplusplus
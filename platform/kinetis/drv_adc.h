@@ -35,6 +35,21 @@ extern "C" {
  * - Driver_ADC0
  * 
  * There is only one ADC (ADC0) on KL25Z. 
+ * 
+ * <b>Interrupt mode</b><br>
+ * After Control(MSF_ADC_MODE_INT, 0) the Read function only starts the conversion
+ * and returns 0. The result is passed to the callback function given to Initialize
+ * with MSF_ADC_EVENT_CONV_COMPLETE event. Together with MSF_ADC_CONV_CONTINUOUS
+ * every conversion is reported (streaming).
+ * 
+ * <b>Oversampling</b><br>
+ * Control(MSF_ADC_OVERSAMPLE_START, N) takes 4^N samples from the current channel 
+ * in the background (using continuous conversions and interrupt) and sums them. 
+ * The result, which has N more bits than the ADC resolution, is then reported by 
+ * MSF_ADC_EVENT_OVERSAMPLE_COMPLETE event. For example, with 16-bit resolution and N = 2
+ * 16 samples are taken and the result is 18-bit number.
+ * Note that the extra resolution is real only if there is some noise in the signal
+ * (at least 1 LSB); the hardware averaging should be disabled for best results.  
  */
 
 /** Version of this drivers API */
@@ -42,7 +57,18 @@ extern "C" {
 
 /** Pointer to call back function for reporting events from the driver to
  * client application. Set in Initialize function */
-typedef void (*MSF_ADC_Event_t) (uint32_t event);   
+typedef void (*MSF_ADC_Event_t) (uint32_t event, uint32_t arg);   
+
+/* The priority of the ADC interrupt; lower number means higher priority.
+ * For KL25Z valid value is 0 thru 3 */
+#define		MSF_ADC_INT_PRIORITY	(2)
+
+/** Flag in the channel number given to SetChannel which selects differential mode 
+ * (DADx inputs instead of single-ended input). The result is then two's complement number. */
+#define		MSF_ADC_CHANNEL_DIFF	(0x20)
+
+/** Max number of extra bits for oversampling; 4^8 16-bit samples still fit into 32-bit sum */
+#define		MSF_ADC_OVERSAMPLE_MAX_BITS		(8)
 
 /* Flags (operations and parameters) for the Control function */
 /* Positions and meaning of the bit-fields:
@@ -55,6 +81,11 @@ typedef void (*MSF_ADC_Event_t) (uint32_t event);
  11:12	0=do not change settings; Select ADC A (1) or ADC B (2) channels .
  13		Reserved
  14:15	ADC reference: 0=do not change; (1)=default (VREFH, VREFL pins); (2)=Alternate pins (VALTH, VALTL).
+ 16:17	Calibration: 0=no operation; (1)=run calibration now; (2)=get calibration data;
+ 		(3)=set calibration data. For get and set the arg is pointer to MSF_ADC_CALIB. 
+ 18:19	Oversampling: 0=no operation; (1)=start oversampling in background, arg = number of 
+ 		extra bits (1 to MSF_ADC_OVERSAMPLE_MAX_BITS); (2)=abort oversampling.
+ 20		Event callback: 0=no change; 1=set the callback to arg (MSF_ADC_Event_t or null). 
   	
  */
 /* Defines for these positions*/
@@ -70,6 +101,12 @@ typedef void (*MSF_ADC_Event_t) (uint32_t event);
 #define		MSF_ADC_ABSEL_Mask		(0x1800)
 #define		MSF_ADC_REFSEL_Pos		(14)
 #define		MSF_ADC_REFSEL_Mask		(0xC000)
+#define		MSF_ADC_CALIB_Pos		(16)
+#define		MSF_ADC_CALIB_Mask		(0x30000)
+#define		MSF_ADC_OVERSAMPLE_Pos	(18)
+#define		MSF_ADC_OVERSAMPLE_Mask	(0xC0000)
+#define		MSF_ADC_EVENT_SET_Pos	(20)
+#define		MSF_ADC_EVENT_SET_Mask	(0x100000)
 
 /* Definitions of the flags */
 /** @defgroup group_adc_control_flags Flags for the ADC driver Control function 
@@ -91,8 +128,49 @@ typedef void (*MSF_ADC_Event_t) (uint32_t event);
 #define     MSF_ADC_ABSEL_B     	(2UL << MSF_ADC_ABSEL_Pos)    /**< Select ADC B */
 #define     MSF_ADC_REFSEL_DEFAULT  (1UL << MSF_ADC_REFSEL_Pos)    /**< Select VREF */
 #define     MSF_ADC_REFSEL_ALT     	(2UL << MSF_ADC_REFSEL_Pos)    /**< Select VALT */
+#define     MSF_ADC_CALIB_RUN     	(1UL << MSF_ADC_CALIB_Pos)    /**< Run the calibration now (takes some ms) */
+#define     MSF_ADC_CALIB_GET     	(2UL << MSF_ADC_CALIB_Pos)    /**< Copy calibration data to MSF_ADC_CALIB pointed to by arg */
+#define     MSF_ADC_CALIB_SET     	(3UL << MSF_ADC_CALIB_Pos)    /**< Restore calibration from MSF_ADC_CALIB pointed to by arg */
+#define     MSF_ADC_OVERSAMPLE_START	(1UL << MSF_ADC_OVERSAMPLE_Pos)    /**< Start oversampling on current channel; arg = extra bits */
+#define     MSF_ADC_OVERSAMPLE_ABORT	(2UL << MSF_ADC_OVERSAMPLE_Pos)    /**< Abort oversampling in progress */
+#define     MSF_ADC_EVENT_SET		(1UL << MSF_ADC_EVENT_SET_Pos)    /**< Replace the callback given to Initialize; arg = the MSF_ADC_Event_t (null = no events). 
+																	The ADC keeps its configuration and calibration. */
+/**@}*/
+
+/* Events reported to the callback function */
+/** @defgroup group_adc_events ADC driver events
+ @{*/
+#define		MSF_ADC_EVENT_CONV_COMPLETE			(1UL << 0)	/**< Conversion complete in interrupt mode; arg = the result */
+#define		MSF_ADC_EVENT_OVERSAMPLE_COMPLETE	(1UL << 1)	/**< Oversampling complete; arg = the result with extended resolution */
 /**@}*/
 
+/** Value of the magic member in valid calibration record */
+#define		MSF_ADC_CALIB_MAGIC		(0xADCA)
+
+/**
+ @brief Calibration data of the ADC.
+ @details The calibration runs in ADC_Initialize and takes several milliseconds.
+ To avoid this on every boot, the application can obtain the result of the calibration
+ with Control(MSF_ADC_CALIB_GET, (uint32_t)&calib) and store it in flash. 
+ If WMSF_ADC_CALIB_ADDRESS is defined in msf_config.h to the address of this data,
+ the driver restores the calibration from there in ADC_Initialize.
+ The full calibration is performed only if the stored data are not valid - that is,
+ the magic or checksum does not match (e.g. erased flash) or the data were obtained
+ with different ADC clock settings.
+ The data can also be restored at any time by Control(MSF_ADC_CALIB_SET, (uint32_t)&calib).
+ @note The application should not change the members; only store the whole structure. 
+*/
+typedef struct _MSF_ADC_CALIB {
+	uint16_t	magic;		/* MSF_ADC_CALIB_MAGIC */
+	uint16_t	config;		/* ADC clock configuration (CFG1) used for the calibration */
+	uint16_t	ofs;		/* offset correction */
+	uint16_t	pg;			/* plus-side gain */
+	uint16_t	mg;			/* minus-side gain */
+	uint16_t	clp[7];		/* plus-side calibration values CLPD, CLPS, CLP4 thru CLP0 */
+	uint16_t	clm[7];		/* minus-side calibration values CLMD, CLMS, CLM4 thru CLM0 */
+	uint16_t	checksum;	/* inverted sum of all the members above */
+} MSF_ADC_CALIB;
+
 /**
 \brief Access structure of the ADC Driver.
 */
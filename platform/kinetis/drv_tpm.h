@@ -21,6 +21,11 @@
  * input capture/output compare/pwm mode. Of course they are not too independent
  * as they share the same counter and other timer settings.
  * 
+ * The values for a channel can also be streamed from a table in memory into
+ * the channel register (CnV) by DMA, see ChannelStream. The timer requests the
+ * DMA transfer on the channel match or on the counter overflow, so there is no 
+ * CPU load (and no jitter) per edge. This requires MSF_TPM_DMA enabled in msf_config.h. 
+ * 
  * <b>Driver objects available in your program</b>
  * - Driver_TPM0
  * - Driver_TPM1
@@ -45,6 +50,13 @@ extern "C" {
  * client application. Set in Initialize function */
 typedef void (*MSF_TPM_Event_t) (uint32_t event, uint32_t arg);
 
+/** Pointer to handler function for single channel of the timer. 
+ * Optional; set by ChannelSetHandler. If set, the driver calls this function 
+ * instead of the MSF_TPM_Event_t callback for the channel event. 
+ * The channel parameter is the number of the channel (0-5) and value is the 
+ * CnV register value (the captured time in input capture mode). */
+typedef void (*MSF_TPM_Channel_Event_t) (uint32_t channel, uint32_t value);
+
 /* The priority of the TPM interrupts; lower number means higher priority.
  * For KL25Z valid value is 0 thru 3 */
 #define		MSF_TPM_INT_PRIORITY	(1)
@@ -56,6 +68,8 @@ typedef void (*MSF_TPM_Event_t) (uint32_t event, uint32_t arg);
  2		prescaler: 0=no change; 1=set according to arg value (arg=0-7 meaning prescaler 1-128 in powers of 2)
  3:4	signal TOF event: 0=no change; 1 =do not signal TOF; 2=signal TOF (timer overflow)
  5		set modulo (TOP) value: 0=no change; 1=set acording to arg
+ 6		reset counter: 0=no change; 1=reset the counter (CNT) to 0
+ 7:8	global time base: 0=no change; 1=use own counter; 2=use global time base (CONF.GTBEEN)
  */
 
 /* Defines for these positions*/
@@ -67,17 +81,25 @@ typedef void (*MSF_TPM_Event_t) (uint32_t event, uint32_t arg);
 #define		MSF_TPM_TOF_Mask		(0x18)
 #define		MSF_TPM_MOD_Pos			(5)
 #define		MSF_TPM_MOD_Mask		(0x20)
+#define		MSF_TPM_CNT_RESET_Pos	(6)
+#define		MSF_TPM_CNT_RESET_Mask	(0x40)
+#define		MSF_TPM_GTB_Pos			(7)
+#define		MSF_TPM_GTB_Mask		(0x180)
 
 /* Definitions of the flags for Control */
 /** @defgroup group_tpm_control_flags Flags for the TPM driver Control function 
  @{*/
 #define     MSF_TPM_CLOCK_NONE  	(1UL << MSF_TPM_CLOCK_MODE_Pos)  /**< disable counter */
 #define     MSF_TPM_CLOCK_INTERNAL  (2UL << MSF_TPM_CLOCK_MODE_Pos)  /**< use internal clock (see SIM->SOPT2) */
-#define     MSF_TPM_CLOCK_EXTERNAL  (3UL << MSF_TPM_CLOCK_MODE_Pos)  /**< use external clock LPTPM_EXTCLK */
+#define     MSF_TPM_CLOCK_EXTERNAL  (3UL << MSF_TPM_CLOCK_MODE_Pos)  /**< use external clock LPTPM_EXTCLK (TPM_CLKINx pin, see WMSF_TPM_CLKIN) */
 #define     MSF_TPM_PRESCALER_SET  	(1UL << MSF_TPM_PRESCALER_Pos)  /**< set prescaler; arg=one of the constants MSF_TPM_PRESCALER_1,... */
 #define		MSF_TPM_TOF_NO_SIGNAL	(1UL << MSF_TPM_TOF_Pos)  		/**< do not signal timer overflow event to user */
 #define		MSF_TPM_TOF_SIGNAL		(2UL << MSF_TPM_TOF_Pos)  		/**< signal timer overflow event to user */
 #define		MSF_TPM_MOD_VALUE		(1UL << MSF_TPM_MOD_Pos)  		/**< set TOP value for counter (MOD register); arg = the value (16-bit) */
+#define		MSF_TPM_COUNTER_RESET	(1UL << MSF_TPM_CNT_RESET_Pos)	/**< reset the counter to 0. The counter is not reset by other operations (except MOD_VALUE). */
+#define		MSF_TPM_GTB_DISABLE		(1UL << MSF_TPM_GTB_Pos)  		/**< the channels use the counter of this timer (default) */
+#define		MSF_TPM_GTB_ENABLE		(2UL << MSF_TPM_GTB_Pos)  		/**< the channels use the global time base of the chip (CONF.GTBEEN); 
+																	all the timers with this option see the same counter */
 
 /* Helper values for Arg parameter in Control() */
 #define		MSF_TPM_PRESCALER_1		(0)   /**< Arg value for the Control function to set prescaler to 1 */
@@ -105,10 +127,24 @@ typedef void (*MSF_TPM_Event_t) (uint32_t event, uint32_t arg);
 #define		MSF_TPM_EVENT_CH3		MSF_TPM_EVENT_CHN(3) /**< Timer channel 3 event.  */
 #define		MSF_TPM_EVENT_CH4		MSF_TPM_EVENT_CHN(4) /**< Timer channel 4 event.  */
 #define		MSF_TPM_EVENT_CH5		MSF_TPM_EVENT_CHN(5) /**< Timer channel 5 event.  */
+/** The DMA finished the table given to ChannelStream (in circular mode it is 
+ * signaled after a number of passes of the table, see the platform driver header). 
+ * The arg is the number of the channel. */
+#define		MSF_TPM_EVENT_STREAM_END	(1UL << 7)
 
 /** Options for the SetChannelMode parameter "args". */
 #define		MSF_TPM_PARAM_CHANNEL_EVENT		(1UL << 0)	/**< enable the signalling the event for this channel (user callback) */
 
+/** The bit in the value returned by CounterRead which is set if the counter overflow (TOF) is pending */
+#define		MSF_TPM_COUNTER_TOF				(1UL << 16)
+
+/** Options for the ChannelStream parameter "flags". */
+#define		MSF_TPM_STREAM_ON_CHANNEL		(0)			/**< write next value on channel match (e.g. output compare pulse train) */
+#define		MSF_TPM_STREAM_ON_OVERFLOW		(1UL << 0)	/**< write next value on counter overflow (e.g. PWM duty waveform) */
+#define		MSF_TPM_STREAM_CIRCULAR			(1UL << 1)	/**< play the table repeatedly until stopped; see the size constraints in the platform driver header */
+/** Max number of values in the table for ChannelStream (the DMA byte counter has 20 bits) */
+#define		MSF_TPM_STREAM_MAX_COUNT		(0x7FFFF)
+
 
 /** TPM driver status flags (configuration), stored in TPM_INFO for each instance */
 #define		MSF_TPM_STATUS_SIGNAL_TOF		MSF_TPM_EVENT_TOF	/**< signal TOF event to user) */
@@ -160,6 +196,10 @@ typedef struct _MSF_DRIVER_TPM {
   uint32_t		(*ChannelSetMode)(uint32_t channel, TMP_channel_mode_t mode, uint32_t args);
   uint32_t		(*ChannelWrite)(uint32_t channel, uint16_t value);
   uint32_t		(*ChannelRead)(uint32_t channel);
+  uint32_t		(*ChannelSetHandler)(uint32_t channel, MSF_TPM_Channel_Event_t handler);
+  MSF_TPM_Channel_Event_t	(*ChannelGetHandler)(uint32_t channel);
+  uint32_t		(*ChannelStream)(uint32_t channel, const uint16_t* table, uint32_t count, uint32_t flags);
+  uint32_t		(*CounterRead)(void);
               
 } const MSF_DRIVER_TPM;
 
@@ -46,6 +46,8 @@ typedef MCU_pin_type  MCU_pin_t;
 #define		GPIO_PIN_MASK(pin)		(1 << GPIO_PIN_NUM(pin) )
 
 // Macros to obtain the addresses of various I/O registers from pin code
+// The host builds (test/host) define their own in derivative.h
+#ifndef GPIO_GPIO_OBJECT
 /** Obtain the address of the GPIO_x structure from pin code. Port number (A=0, etc. is encoded
  * as lowest byte in pin code */
 #define		GPIO_GPIO_OBJECT(pin)		((GPIO_Type *)(PTA_BASE + (PTB_BASE-PTA_BASE)*(pin & 0x00FF)))
@@ -53,6 +55,7 @@ typedef MCU_pin_type  MCU_pin_t;
 /** Obtain the address of the PORT_x structure from pin code. Port number (A=0, etc. is encoded
  * as lowest byte in pin code */
 #define		GPIO_PORT_OBJECT(pin)		((PORT_Type *)(PORTA_BASE + (PORTB_BASE-PORTA_BASE)*(pin & 0x00FF)))
+#endif
 
 // Macros which allow us to refer to the I/O registers directly
 #define		GPIO_DDR_REG(pin)    	GPIO_GPIO_OBJECT(pin)->PDDR
@@ -342,24 +342,37 @@ typedef enum
 	#undef MSF_SYSTICK_VALINUS
 	#define MSF_SYSTICK_VALINUS		(21)	
 #endif 
+
+/** Multiplier to convert the SysTick count to microseconds without division:
+ * us = (count * WMSF_SYSTICK_US_MULT) >> 16. It is rounded down, so that the
+ * microseconds within 1 ms never reach 1000. */
+#define		WMSF_SYSTICK_US_MULT	((uint32_t)((1000000ULL << 16) / F_CPU))
+
+#if MSF_TICKLESS
+/** Period of the PIT channel 0 which keeps the time in tickless mode, in seconds.
+ * The PIT is clocked by bus clock; the period must fit into 32 bits. */
+#define		WMSF_TICKLESS_PERIOD_S	(60)
+#define		WMSF_PIT_PERIOD_TICKS	((uint32_t)F_BUS * WMSF_TICKLESS_PERIOD_S)
+/** Multipliers to convert the PIT count to us and ms: 
+ * us = (count * WMSF_PIT_US_MULT) >> 36; ms = (count * WMSF_PIT_MS_MULT) >> 40 */
+#define		WMSF_PIT_US_MULT		((1000000ULL << 36) / F_BUS)
+#define		WMSF_PIT_MS_MULT		((1000ULL << 40) / F_BUS)
+#endif
  
  
-/** how many clocks there are in one microsecond 
- * NOTE that we need this as compile-time constant to make the error in msf_delay_us
- * as small as possible */
-#if ((F_CPU == 20900000) || (F_CPU == 20970000))
-	#define	MSF_CLOCKS_PER_US		(21)
-	#define	WMSF_DELAYUS_OVERHEAD	(6)
-#elif F_CPU == 41943040	
-	#define	MSF_CLOCKS_PER_US		(42)
-	#define	WMSF_DELAYUS_OVERHEAD	(3)
-#elif F_CPU == 48000000
-	#define	MSF_CLOCKS_PER_US		(48)
-	#define WMSF_DELAYUS_OVERHEAD  (2)
-#elif F_CPU == 4000000
-	#define	MSF_CLOCKS_PER_US		(4)
-	#define WMSF_DELAYUS_OVERHEAD  (30)	/* TODO: this is not tested! */
-#endif 
+/** how many clocks there are in one microsecond (rounded) */
+#define	MSF_CLOCKS_PER_US		((F_CPU + 500000) / 1000000)
+
+/* Constants for msf_delay_us; derived from F_CPU, so that it works for any CPU clock.
+ * The delay loop takes 4 clocks per pass. */
+/** number of loops per microsecond multiplied by 256 (rounded) */
+#define	WMSF_DELAYUS_LOOPS_Q8	((uint32_t)(((uint64_t)F_CPU * 256 + 2000000) / 4000000))
+/** number of loops per second */
+#define	WMSF_DELAYUS_LOOPS_1S	((uint32_t)(F_CPU / 4))
+/** clocks spent in msf_delay_us outside the loop: call and return (about 11),
+ * the conversion of us to loops (about 8) and the checks (about 5) */
+#define	WMSF_DELAYUS_OVERHEAD	(24)
+#define	WMSF_DELAYUS_OVERHEAD_LOOPS	((WMSF_DELAYUS_OVERHEAD + 2) / 4)
 
 /* -------------- End Main "system" timer definitions  --------------- */
 
@@ -372,8 +385,9 @@ typedef enum
   * Naming convention in the KL25Z manual: 
   * DAD = Differential Analog Input
   * DADMx and DADPx are pair of pins used in differential 
-  * mode (which MSF driver does not support).
-  * In single-ended mode (MSF supported), each DADPx can be used (is an input), SOME DADMx also.
+  * mode. The differential pairs have AIN_DIFF_ in the name and the result is 
+  * signed number (two's complement) - cast it to int16_t.
+  * In single-ended mode, each DADPx can be used (is an input), SOME DADMx also.
   * The signals for these pins are named ADC0_DPx and ADC0_DMx.
   * For single ended inputs the signals are ADC0_SEx
   * IMPORTANT: There may be 2 pins for the same channel number; which one is used depends on the
@@ -391,6 +405,9 @@ typedef enum
 #define		MSF_ADCA_ONLY	(0x0080)	
 #define		MSF_ADCB_ONLY	(0x0100)
 #define		MSF_ADC_BOTH	(MSF_ADCA_ONLY | MSF_ADCB_ONLY) 
+/* Indicates differential channel; the same value as MSF_ADC_CHANNEL_DIFF in the ADC driver
+ * so that MSF_PIN2CHANNEL gives the channel code for the driver directly. */
+#define		MSF_ADC_DIFF	(0x0020)
  /** Macro to check if channel is available in A converter mode*/
 #define		MSF_ADC_ISA_CHANNEL(ain_code)	(ain_code & MSF_ADCA_ONLY) 
 #define		MSF_ADC_ISB_CHANNEL(ain_code)	(ain_code & MSF_ADCB_ONLY)
@@ -425,10 +442,15 @@ typedef enum
      /* no more channels available on any KL25Z */
      AIN_E30 = MSF_ADC_MAKECODE(MSF_ADC_BOTH, 23),		/* SE23, also DAC0 output */
      AIN_TEMPERATURE = MSF_ADC_MAKECODE(MSF_ADC_BOTH, 26),	/* Temperature sensor */
-     /*AIN_BANDGAP = 27,*/	/* Bandgap 1V, needs enabling buffer first; not supported */
+     AIN_BANDGAP = MSF_ADC_MAKECODE(MSF_ADC_BOTH, 27),	/* Bandgap 1V; the driver enables the bandgap buffer when selected */
      AIN_VREFH = MSF_ADC_MAKECODE(MSF_ADC_BOTH, 29),
      AIN_VREFL = MSF_ADC_MAKECODE(MSF_ADC_BOTH, 30),
      AIN_ADC_DISALED = MSF_ADC_MAKECODE(MSF_ADC_BOTH, 31),	/* The value which disables ADC module*/
+     /* Differential inputs; the A/B selection does not apply to these */
+     AIN_DIFF_E20_E21 = MSF_ADC_MAKECODE(MSF_ADC_BOTH | MSF_ADC_DIFF, 0),	/* DAD0: DP0 = PTE20, DM0 = PTE21 */
+     AIN_DIFF_E22_E23 = MSF_ADC_MAKECODE(MSF_ADC_BOTH | MSF_ADC_DIFF, 3),	/* DAD3: DP3 = PTE22, DM3 = PTE23 */
+     AIN_DIFF_TEMPERATURE = MSF_ADC_MAKECODE(MSF_ADC_BOTH | MSF_ADC_DIFF, 26),	/* Temperature sensor, differential */
+     AIN_DIFF_BANDGAP = MSF_ADC_MAKECODE(MSF_ADC_BOTH | MSF_ADC_DIFF, 27),	/* Bandgap, differential */
      
      
   }  Analog_pin_t;
@@ -473,10 +495,23 @@ typedef enum
   */
 #define		WMSF_ADC_CLOCK	(0)
  
+/* Internal voltage reference (bandgap) in mV; typical value from the datasheet */
+#define		WMSF_ADC_BANDGAP_MV		(1000)
+ 
+/* Temperature sensor parameters from the datasheet: 
+ voltage at 25 C in 0.1 mV units and the slope.
+ The slope is 1.62 mV/C so the factor for converting 0.1 mV to 0.1 C is 1/1.62 = 0.6173, 
+ which is expressed as fraction 40454/65536 */
+#define		WMSF_ADC_TEMP25_MV10	(7160)
+#define		WMSF_ADC_TEMP_SLOPE_MUL	(40454)
+ 
  
  /** Macro which check for ADC conversion completion.
-   Evaluates to true if conversion is complete. */
+   Evaluates to true if conversion is complete. 
+   The host builds (test/host) define their own in derivative.h */
+#ifndef WMSF_ADCA_COMPLETE
 #define     WMSF_ADCA_COMPLETE(reg)       ( (reg->SC1[0] & ADC_SC1_COCO_MASK) != 0)
+#endif
 #define     WMSF_ADCB_COMPLETE(reg)       ( (reg->SC1[1] & ADC_SC1_COCO_MASK) != 0)
        
 /* -------------- End ADC definitions  --------------- */
@@ -497,6 +532,23 @@ typedef enum
  * */ 
 #define	MSF_TPM_CLKSEL		MSF_UART0_CLKSEL	/* use the same value as UART0 */
 
+/** The frequency of the internal clock for timers TPMn in Hz (see the table above) */
+#if F_CPU == 48000000
+	#define	WMSF_TPM_CLOCK		(8000000UL)
+#elif ((F_CPU == 20900000) || (F_CPU == 20970000))
+	#define	WMSF_TPM_CLOCK		(F_CPU)
+#elif  F_CPU == 8000000
+	#define	WMSF_TPM_CLOCK		(8000000UL)
+#elif  F_CPU == 4000000
+	#if F_BUS == 800000
+		#define	WMSF_TPM_CLOCK		(4000000UL)
+	#else
+		#define	WMSF_TPM_CLOCK		(8000000UL)
+	#endif
+#elif F_CPU == 41943040
+	#define	WMSF_TPM_CLOCK		(41943040UL)
+#endif
+
 /* -------------- End TPM timer definitions  --------------- */
 
 
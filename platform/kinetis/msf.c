@@ -9,6 +9,8 @@
  *          varaibles. It is out of scope for MSF to support setting the clock;
  *          We assume user sets the clock and lets us know about the speed
  *          using the F_CPU constant defined in user config .h file.
+ *          The exception is switching between few predefined clocks in 
+ *          runtime with MSF_CLOCK_SWITCH, see msf_clock.c.
  *
  ******************************************************************************/
 
@@ -39,7 +41,67 @@
  initialized to interrupt every ms in msf_init()
 */
 volatile uint32_t   gmsf_systime;
+/** the upper 32 bits of the system time in ms (incremented when gmsf_systime overflows) */
+volatile uint32_t   gmsf_systime_hi;
 volatile uint32_t   gmsf_delaycnt;
+/** function called repeatedly while msf_delay_ms waits; see msf_set_idle_hook */
+static MSF_IDLE_HOOK gmsf_idle_hook;
+/** the idle hook is running (msf_delay_ms called from the hook does not call it again) */
+static volatile uint8_t gmsf_in_idle_hook;
+
+#if MSF_CLOCK_SWITCH
+#if MSF_TICKLESS
+	#error "The CPU clock switching is not supported in tickless mode"
+#endif
+/* The constants for converting the SysTick count and for msf_delay_us are 
+ * variables which msf_clock_set changes with the CPU clock */
+static uint32_t gmsf_systick_us_mult = WMSF_SYSTICK_US_MULT;
+static uint32_t gmsf_delayus_loops_q8 = WMSF_DELAYUS_LOOPS_Q8;
+static uint32_t gmsf_delayus_loops_1s = WMSF_DELAYUS_LOOPS_1S;
+/** added to the ticks computed from the time in ms, so that msf_ticks64 continues 
+ * from the same value after the SysTick period changed */
+static uint64_t gmsf_ticks_offset;
+#define	WMSF_US_MULT			gmsf_systick_us_mult
+#define	WMSF_US_LOOPS_Q8		gmsf_delayus_loops_q8
+#define	WMSF_US_LOOPS_1S		gmsf_delayus_loops_1s
+#define	WMSF_TICKS_OFFSET		gmsf_ticks_offset
+#else
+#define	WMSF_US_MULT			WMSF_SYSTICK_US_MULT
+#define	WMSF_US_LOOPS_Q8		WMSF_DELAYUS_LOOPS_Q8
+#define	WMSF_US_LOOPS_1S		WMSF_DELAYUS_LOOPS_1S
+#define	WMSF_TICKS_OFFSET		0
+#endif
+
+/* Busy loop of 4 CPU cycles per pass; the last pass takes 3 cycles */
+static inline void wmsf_delay_loops(uint32_t loops) __attribute__((always_inline));
+static inline void wmsf_delay_loops(uint32_t loops)
+{
+	__asm__ __volatile__ (
+				"1: SUB %0, #1" "\n\t"	// 1 clock
+				"NOP" "\n\t"			// 1 clock
+				"BNE 1b"  				// 2 clocks if branches, 1 if not
+			 : "+l" (loops)
+			 :
+			 : "cc"
+			);
+}
+
+#if MSF_LOWPOWER && MSF_TICKLESS
+	#error "The low-power manager is not supported in tickless mode"
+#endif
+
+#if MSF_TICKLESS
+/** number of periods of the PIT channel 0 (WMSF_TICKLESS_PERIOD_S each) in tickless mode */
+volatile uint32_t   gmsf_periods;
+
+static void wmsf_tickless_init(void);
+#if MSF_DELAY_SLEEP
+static void wmsf_tickless_wakeup(uint64_t ticks);
+#endif
+static uint32_t wmsf_pit_snapshot(uint32_t* elapsed);
+#else
+static uint32_t wmsf_systick_snapshot(uint32_t* ms_hi, uint32_t* elapsed);
+#endif
 
 /** @addtogroup group_globals  
 * @{ 
@@ -51,16 +113,27 @@ uint8_t msf_init(uint32_t param)
     uint8_t err = MSF_ERROR_OK;
     
     gmsf_systime = 0;
+    gmsf_systime_hi = 0;
     gmsf_delaycnt = 0;
     
+#if MSF_TICKLESS
+    /* No periodic interrupt; the time is kept by free-running PIT */
+    wmsf_tickless_init();
+#else
     /* Use SysTick as reference for the delay loops. 
     Configure the SysTick interrupt to occur every ms */
     if ( SysTick_Config (SystemCoreClock / 1000u ) != 0 )
     	err = MSF_ERROR_SYSTIMER;
+#endif
     
     /* Kinetis (ARM) needs enabling clock to GPIO ports*/
     gpio_init();
     
+#if MSF_LOWPOWER
+    /* allow the stop modes and prepare the wake-up sources */
+    wmsf_lowpower_init();
+#endif
+    
 	// initialize standard I/O if desired
 #if MSF_USE_STDIO
 	coniob_init(MSF_STDIO_BAUDRATE);	
@@ -78,6 +151,135 @@ uint8_t msf_init(uint32_t param)
   
 }
 
+/* Register function to be called while msf_delay_ms waits */
+void msf_set_idle_hook(MSF_IDLE_HOOK hook)
+{
+	gmsf_idle_hook = hook;
+}
+
+#if MSF_DELAY_SLEEP
+/* Call the idle hook if there is one; returns 0 if there is none (or it is already running) */
+static uint8_t wmsf_call_idle_hook(void)
+{
+	MSF_IDLE_HOOK hook = gmsf_idle_hook;
+	
+	if ( hook == null || gmsf_in_idle_hook )
+		return 0;
+	gmsf_in_idle_hook = 1;
+	hook();
+	gmsf_in_idle_hook = 0;
+	return 1;
+}
+#endif
+
+#if MSF_TICKLESS
+void msf_delay_ms(uint32_t millis)
+{
+	uint64_t end = msf_ticks64() + (uint64_t)millis * (F_BUS / 1000u);
+#if MSF_DELAY_SLEEP
+	uint64_t now;
+	
+	while ( msf_ticks64() < end )
+	{
+		MSF_RESET_WATCHDOG();
+		if ( wmsf_call_idle_hook() )
+			continue;
+		/* Schedule interrupt at the end of the delay and sleep until it (or other interrupt).
+		 * It is scheduled again after each interrupt, because the idle hook or 
+		 * an interrupt handler could call msf_delay_ms and use the wake-up for its own delay. */
+		MSF_ATOMIC_BEGIN();
+		now = msf_ticks64();
+		if ( now < end )
+		{
+			wmsf_tickless_wakeup(end - now);
+			__WFI();
+		}
+		MSF_ATOMIC_END();
+	}
+#else
+	while ( msf_ticks64() < end )
+		MSF_RESET_WATCHDOG();
+#endif
+}
+
+uint32_t msf_millis()
+{
+	uint32_t periods, elapsed;
+	
+	periods = wmsf_pit_snapshot(&elapsed);
+	return periods * (WMSF_TICKLESS_PERIOD_S * 1000u) 
+			+ (uint32_t)(((uint64_t)elapsed * WMSF_PIT_MS_MULT) >> 40);
+}
+
+uint32_t msf_micros()
+{
+	uint32_t periods, elapsed;
+	
+	/* The PIT counts F_BUS per second; the count is converted by multiplication with
+	 * fixed-point reciprocal (no division) */
+	periods = wmsf_pit_snapshot(&elapsed);
+	return periods * (WMSF_TICKLESS_PERIOD_S * 1000000u) 
+			+ (uint32_t)(((uint64_t)elapsed * WMSF_PIT_US_MULT) >> 36);
+}
+
+uint64_t msf_millis64(void)
+{
+	uint32_t periods, elapsed;
+	
+	periods = wmsf_pit_snapshot(&elapsed);
+	return (uint64_t)periods * (WMSF_TICKLESS_PERIOD_S * 1000u) 
+			+ (((uint64_t)elapsed * WMSF_PIT_MS_MULT) >> 40);
+}
+
+uint64_t msf_micros64(void)
+{
+	uint32_t periods, elapsed;
+	
+	periods = wmsf_pit_snapshot(&elapsed);
+	return (uint64_t)periods * (WMSF_TICKLESS_PERIOD_S * 1000000u) 
+			+ (((uint64_t)elapsed * WMSF_PIT_US_MULT) >> 36);
+}
+
+uint64_t msf_ticks64(void)
+{
+	uint32_t periods, elapsed;
+	
+	periods = wmsf_pit_snapshot(&elapsed);
+	return (uint64_t)periods * WMSF_PIT_PERIOD_TICKS + elapsed;
+}
+
+uint32_t msf_ticks32(void)
+{
+	uint32_t periods, elapsed;
+	
+	periods = wmsf_pit_snapshot(&elapsed);
+	return periods * WMSF_PIT_PERIOD_TICKS + elapsed;
+}
+
+#else	/* MSF_TICKLESS */
+
+#if MSF_DELAY_SLEEP
+void msf_delay_ms(uint32_t millis)
+{
+	uint32_t start = gmsf_systime;
+	
+	/* The SysTick wakes up the CPU every ms. The difference of the times is used instead
+	 * of the gmsf_delaycnt, so that msf_delay_ms can be called from the idle hook 
+	 * or an interrupt handler while another delay is in progress. */
+	while ( (gmsf_systime - start) < millis )
+	{
+		MSF_RESET_WATCHDOG();
+		if ( wmsf_call_idle_hook() )
+			continue;
+		/* The time must be checked with the interrupts disabled, otherwise the SysTick 
+		 * just before the WFI would extend the delay by 1 ms */
+		MSF_ATOMIC_BEGIN();
+		if ( (gmsf_systime - start) < millis )
+			__WFI();
+		MSF_ATOMIC_END();
+	}
+}
+#else
 void msf_delay_ms(uint32_t millis)
 {
     gmsf_delaycnt = millis;
@@ -86,6 +288,7 @@ void msf_delay_ms(uint32_t millis)
     while (gmsf_delaycnt != 0u)
         MSF_RESET_WATCHDOG();   
 }
+#endif	/* MSF_DELAY_SLEEP */
 
 
 uint32_t msf_millis()
@@ -96,113 +299,124 @@ uint32_t msf_millis()
 
 uint32_t msf_micros()
 {   
-	uint32_t fraction = (SysTick->LOAD - SysTick->VAL) / MSF_SYSTICK_VALINUS;
+	uint32_t ms, elapsed;
 	/* The value in the SysTick->LOAD register is the number of clock ticks
 	 * between SysTick interrupts. The VAL register is loaded with this value
 	 * and then decremented. When it reaches 0, SysTick interrupt occurs.
 	 * msf_init sets the interrupt to occur every ms, so the value in
 	 * LOAD is (SystemCoreClock / 1000) and this is how many "ticks" there are
 	 * in 1 ms. 
-	 * msf_<device>.h defines constant we use to convert the count in LOAD to us  */
+	 * msf_<device>.h defines constant we use to convert the count to us 
+	 * by multiplication and shift rather than division (there is no divide 
+	 * instruction in Cortex-M0+) */
+	ms = wmsf_systick_snapshot(null, &elapsed);
+    return (ms * 1000u + ((elapsed * WMSF_US_MULT) >> 16));
+}
+
+uint64_t msf_millis64(void)
+{
+	uint32_t ms, hi, elapsed;
+	
+	ms = wmsf_systick_snapshot(&hi, &elapsed);
+	return (((uint64_t)hi << 32) | ms);
+}
+
+uint64_t msf_micros64(void)
+{
+	uint32_t ms, hi, elapsed;
+	
+	ms = wmsf_systick_snapshot(&hi, &elapsed);
+	return ((((uint64_t)hi << 32) | ms) * 1000u + ((elapsed * WMSF_US_MULT) >> 16));
+}
+
+uint64_t msf_ticks64(void)
+{
+	uint32_t ms, hi, elapsed;
 	
-    return (msf_millis() * 1000u + fraction);
+	ms = wmsf_systick_snapshot(&hi, &elapsed);
+	return ((((uint64_t)hi << 32) | ms) * (SysTick->LOAD + 1) + elapsed + WMSF_TICKS_OFFSET);
 }
 
+uint32_t msf_ticks32(void)
+{
+	uint32_t ms, elapsed;
+	
+	/* the lower 32 bits of the product do not depend on the upper word of the time */
+	ms = wmsf_systick_snapshot(null, &elapsed);
+	return (ms * (SysTick->LOAD + 1) + elapsed + (uint32_t)WMSF_TICKS_OFFSET);
+}
+
+#if MSF_CLOCK_SWITCH
+/* Set the SysTick and the time conversions for new CPU clock.
+ * Called by msf_clock_set with the interrupts disabled right after the clock changed.
+ * The SysTick VAL cannot be written (any write clears it), so the rest of the current ms is 
+ * counted with a shortened period and the full period is set after the counter reloaded;
+ * this way the time does not jump. */
+void wmsf_systime_retime(uint32_t cpu_clock)
+{
+	uint32_t ms, hi, elapsed, period, rest;
+	uint64_t ms64, ticks;
+	
+	ms = wmsf_systick_snapshot(&hi, &elapsed);
+	ms64 = ((uint64_t)hi << 32) | ms;
+	ticks = ms64 * (SysTick->LOAD + 1) + elapsed + gmsf_ticks_offset;
+	
+	/* the rest of the current ms in the counts of the new clock; 
+	 * both the numbers are at most 48000, so the product fits 32 bits */
+	period = cpu_clock / 1000u;
+	rest = ((SysTick->LOAD + 1 - elapsed) * period) / (SysTick->LOAD + 1);
+	if ( rest < 2 )
+		rest = 2;
+	
+	SysTick->LOAD = rest - 1;
+	SysTick->VAL = 0;
+	while ( SysTick->VAL == 0 )
+		;	/* the counter reloads on the next clock */
+	SysTick->LOAD = period - 1;		/* used from the next reload */
+	
+	/* After the reload the elapsed count is (period - rest) */
+	gmsf_ticks_offset = ticks - (ms64 * period + (period - rest));
+	gmsf_systick_us_mult = (uint32_t)((1000000ULL << 16) / cpu_clock);
+	gmsf_delayus_loops_q8 = (uint32_t)(((uint64_t)cpu_clock * 256 + 2000000) / 4000000);
+	gmsf_delayus_loops_1s = cpu_clock / 4;
+}
+#endif	/* MSF_CLOCK_SWITCH */
+#endif	/* MSF_TICKLESS */
+
 /**
  *  @note There are some limitations:
- * 	- The function works reliably from certain minimal value (depending on F_CPU) - about 6 us 
- * 	 for F_CPU 8 and 21 MHz, about 2 us for 48 MHz.
- * 	- The results are better for F_CPU in exact MHz, e.g. 48 MHz  is better than 41.9 MHz - see clock options. 
+ * 	- The loop takes 4 CPU cycles, so the resolution is 4 cycles (e.g. 1/12 us at 48 MHz). 
+ * 	 The overhead of the call and conversion (WMSF_DELAYUS_OVERHEAD cycles) is subtracted, so
+ * 	 the function works from about 1 us at 48 MHz and 5 us at 4 MHz.
+ * 	- The conversion uses multiplication by a constant derived from F_CPU, so it works for any F_CPU.
+ * 	 With MSF_CLOCK_SWITCH the constant is changed by msf_clock_set.
  *  - If interrupts occur while this delay is in progress the delay time will be longer
  *  (as this si simple busy loop it will execute given number of times, not knowing that 
  *  some time elapsed in ISR.
  *  - It is safe to call this function from ISR; it will function ok.
- *  - The maximum delay is about 2 ^32 / 6 so about 715 millions of us, but it does not make
- *  much sense to call this function for delays longer than few millisecond; use delay_ms instead
- *  combined with delay_us if desired.
- *  - When testing this function note the overhead in measuring the time with msf_micros() which is
- *  about 26 us! (as of May 2014 version). 
+ *  - It does not make much sense to call this function for delays longer than few millisecond; 
+ *  use delay_ms instead combined with delay_us if desired.
+ *  - When testing this function note the overhead in measuring the time with msf_micros(). It was
+ *  about 26 us in May 2014 version; now it uses no division and is in the order of 1 us at 48 MHz.
+ *  For exact measurement use msf_delay_selftest.
  *  
  */
 void msf_delay_us(uint32_t micros)
 {
-	/* convert us to clock cycles and divide by 3 as the loop below
-	 * takes 3 cycles */
-	
-	
-#if F_CPU > 20000000
-	/* There is some overhead for the function call which we have defined in the
-	 * msf_<device>.h  for each F_CPU*/
-	if ( micros <= WMSF_DELAYUS_OVERHEAD )
-			return;
-	micros -= WMSF_DELAYUS_OVERHEAD;
-		
-	/* For F_CPU > 20 MHz we assume we can calculate the micro to clocks without
-	 * bringing big error into the delay 
-	 * Divide by 7 because the ASM loop takes 7 cycles and 7 cycles because
-	 * this makes (MSF_CLOCKS_PER_US / 7) nice number for the common F_CPU */
-	 micros = micros * MSF_CLOCKS_PER_US / 7;
-	__asm__ __volatile__ (				
-				"1: SUB %0, #1" "\n\t"	// 1 clock
-				"nop" "\n\t"			// 1 clock 
-				"nop" "\n\t"			// 1 clock 
-				"nop" "\n\t"			// 1 clock 
-				"nop" "\n\t"			// 1 clock 
-				"BNE 1b"  				// 2 clocks if branches, 1 if not
-			 : /* no outputs */ 
-			 : "r" (micros)  
-			);
+	uint32_t loops;
 	
+	/* Whole seconds separately, so that the multiplication below does not overflow */
+	while ( micros >= 1000000u )
+	{
+		wmsf_delay_loops(WMSF_US_LOOPS_1S);
+		micros -= 1000000u;
+	}
 	
-#elif F_CPU == 8000000
-	/* There is about 3 us overhead at 8 MHz F_CPU for the function call */
-	if ( micros <= 3 )
+	/* convert us to number of 4-cycle loops; the overhead of this function is subtracted */
+	loops = (micros * WMSF_US_LOOPS_Q8) >> 8;
+	if ( loops <= WMSF_DELAYUS_OVERHEAD_LOOPS )
 		return;
-	micros -= 3;
-	 /* r0 register holds the input argument (micros) but
-	  * after any manipulation in C the result is in r3 */
-	/* ASM loop which takes 8 clocks, that is 1 us */
-	__asm__ __volatile__ (
-			//"a: nop" "\n\t" 	// 1 clock
-			"1: SUB %0, #1" "\n\t"	// 1 clock
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"BNE 1b"  				// 2 clocks if branches, 1 if not
-			: /* no outputs */ 
-			: "r" (micros)
-		);
-
-#elif F_CPU == 4000000
-
-	/* There is about 6 us (?) overhead at 4 MHz F_CPU for the function call */
-	if ( micros <= 6 )
-		return;
-	micros -= 6;
-	 /* r0 register holds the input argument (micros) but
-	  * after any manipulation in C the result is in r3 */
-	/* ASM loop which takes 8 clocks, that is 1 us */
-	__asm__ __volatile__ (
-			//"a: nop" "\n\t" 	// 1 clock
-			"1: SUB %0, #1" "\n\t"	// 1 clock
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"nop" "\n\t"
-			"BNE 1b"  				// 2 clocks if branches, 1 if not
-			: /* no outputs */
-			: "r" (micros)
-		);
-#else
-	#error msf_delay_us is not implemented for this F_CPU. 
-#endif
-	
-	
-		
-	
+	wmsf_delay_loops(loops - WMSF_DELAYUS_OVERHEAD_LOOPS);
 	
 	/* Abandoned version with polling of SysTick timer. 
 	 * It has big overhead which depends on F_CPU and thus no advantage
@@ -247,14 +461,209 @@ void msf_delay_us(uint32_t micros)
 	
 }
 
+#if MSF_DELAY_SELFTEST
+/* Number of SysTick counts between two readings; the SysTick counts down */
+static uint32_t wmsf_systick_diff(uint32_t start, uint32_t end)
+{
+	return (start >= end) ? (start - end) : (start + SysTick->LOAD + 1 - end);
+}
+
+/* Measure constant delay and count it as error if it does not take exactly n cycles */
+#define	WMSF_DELAY_CHECK(n)	do { \
+		MSF_ATOMIC_BEGIN(); \
+		start = SysTick->VAL; \
+		msf_delay_cycles(n); \
+		end = SysTick->VAL; \
+		MSF_ATOMIC_END(); \
+		if ( wmsf_systick_diff(start, end) - overhead != (n) ) \
+			errors++; \
+	} while (0)
+
+/* Measure msf_delay_us; it is error if it differs from the exact time by more than 2 loops */
+#define	WMSF_DELAYUS_CHECK(us)	do { \
+		MSF_ATOMIC_BEGIN(); \
+		start = SysTick->VAL; \
+		msf_delay_us(us); \
+		end = SysTick->VAL; \
+		MSF_ATOMIC_END(); \
+		cycles = wmsf_systick_diff(start, end) - overhead; \
+		if ( abs((int32_t)cycles - (int32_t)MSF_US_TO_CYCLES(us)) > 8 ) \
+			errors++; \
+	} while (0)
+
+/* Verify the cycle counts of the generated delays */
+uint8_t msf_delay_selftest(void)
+{
+	uint32_t start, end, overhead, cycles;
+	uint32_t ctrl = SysTick->CTRL, load = SysTick->LOAD;
+	uint8_t errors = 0;
+	
+	/* Run the SysTick with the full 24-bit period and without interrupt for the test,
+	 * so that each measured delay wraps the counter at most once at any CPU clock.
+	 * The system time (msf_millis) does not advance during the test. */
+	SysTick->CTRL = 0;
+	SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+	SysTick->VAL = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+	
+	/* the time of reading the timer itself */
+	MSF_ATOMIC_BEGIN();
+	start = SysTick->VAL;
+	end = SysTick->VAL;
+	MSF_ATOMIC_END();
+	overhead = wmsf_systick_diff(start, end);
+	
+	/* each way of generating the delay and the boundaries between them */
+	WMSF_DELAY_CHECK(1);
+	WMSF_DELAY_CHECK(3);
+	WMSF_DELAY_CHECK(4);
+	WMSF_DELAY_CHECK(5);
+	WMSF_DELAY_CHECK(6);
+	WMSF_DELAY_CHECK(100);
+	WMSF_DELAY_CHECK(767);
+	WMSF_DELAY_CHECK(768);
+	WMSF_DELAY_CHECK(770);
+	WMSF_DELAY_CHECK(10000);
+	WMSF_DELAY_CHECK(196609);
+	WMSF_DELAY_CHECK(196610);
+	WMSF_DELAY_CHECK(1000000);
+	WMSF_DELAY_CHECK(MSF_US_TO_CYCLES(1));
+	WMSF_DELAY_CHECK(MSF_US_TO_CYCLES(5));
+	WMSF_DELAY_CHECK(MSF_US_TO_CYCLES(10));
+	
+	WMSF_DELAYUS_CHECK(10);
+	WMSF_DELAYUS_CHECK(100);
+	WMSF_DELAYUS_CHECK(500);
+	
+	/* restore the SysTick; the period starts again from the beginning */
+	SysTick->CTRL = 0;
+	SysTick->LOAD = load;
+	SysTick->VAL = 0;
+	SysTick->CTRL = ctrl;
+	(void)cycles;
+	return errors;
+}
+#endif	/* MSF_DELAY_SELFTEST */
+
 /** @}*/
 
-/* Handler for the SysTick interrupt.
-The name of the function is pre-defined by CMSIS */
-void SysTick_Handler (void)
+#if MSF_TICKLESS
+/* Start the PIT: channel 0 free-running with the period of WMSF_TICKLESS_PERIOD_S
+ * keeps the time; channel 1 is used for wake-up interrupts (one-shot). */
+static void wmsf_tickless_init(void)
+{
+	gmsf_periods = 0;
+	SIM->SCGC6 |= SIM_SCGC6_PIT_MASK;
+	PIT->MCR = PIT_MCR_FRZ_MASK;	/* enable the module; stop in debug mode */
+	PIT->CHANNEL[0].TCTRL = 0;
+	PIT->CHANNEL[1].TCTRL = 0;
+	PIT->CHANNEL[0].LDVAL = WMSF_PIT_PERIOD_TICKS - 1;
+	PIT->CHANNEL[0].TFLG = PIT_TFLG_TIF_MASK;
+	PIT->CHANNEL[1].TFLG = PIT_TFLG_TIF_MASK;
+	NVIC_ClearPendingIRQ(PIT_IRQn);
+	NVIC_EnableIRQ(PIT_IRQn);
+	PIT->CHANNEL[0].TCTRL = PIT_TCTRL_TIE_MASK | PIT_TCTRL_TEN_MASK;
+}
+
+#if MSF_DELAY_SLEEP
+/* Schedule wake-up interrupt after given time in PIT ticks; the interrupt does nothing 
+ * else but wakes up the CPU waiting for interrupt. Longer time than the PIT can count is limited. */
+static void wmsf_tickless_wakeup(uint64_t ticks)
+{
+	if ( ticks == 0 )
+		return;
+	if ( ticks > 0xFFFFFFFFu )
+		ticks = 0xFFFFFFFFu;
+	PIT->CHANNEL[1].TCTRL = 0;
+	PIT->CHANNEL[1].LDVAL = (uint32_t)ticks - 1;
+	PIT->CHANNEL[1].TFLG = PIT_TFLG_TIF_MASK;
+	PIT->CHANNEL[1].TCTRL = PIT_TCTRL_TIE_MASK | PIT_TCTRL_TEN_MASK;
+}
+#endif
+
+/* Read the number of PIT periods and the count elapsed in the current period so that
+ * they belong together; the same as wmsf_systick_snapshot for the SysTick. */
+static uint32_t wmsf_pit_snapshot(uint32_t* elapsed)
+{
+	uint32_t periods, val, carry;
+	
+	do 
+	{
+		periods = gmsf_periods;
+		val = PIT->CHANNEL[0].CVAL;
+		carry = 0;
+		if ( PIT->CHANNEL[0].TFLG & PIT_TFLG_TIF_MASK )
+		{
+			val = PIT->CHANNEL[0].CVAL;		/* surely after the reload */
+			carry = 1;
+		}
+	} while ( periods != gmsf_periods );
+	
+	*elapsed = (WMSF_PIT_PERIOD_TICKS - 1) - val;
+	return periods + carry;
+}
+
+/* Handler for the PIT interrupt (both channels) */
+void PIT_IRQHandler(void)
+{
+	if ( PIT->CHANNEL[0].TFLG & PIT_TFLG_TIF_MASK )
+	{
+		PIT->CHANNEL[0].TFLG = PIT_TFLG_TIF_MASK;
+		gmsf_periods++;
+	}
+	
+	if ( PIT->CHANNEL[1].TFLG & PIT_TFLG_TIF_MASK )
+	{
+		/* one-shot wake-up */
+		PIT->CHANNEL[1].TCTRL = 0;
+		PIT->CHANNEL[1].TFLG = PIT_TFLG_TIF_MASK;
+	}
+}
+
+#else	/* MSF_TICKLESS */
+
+/* Read the system time in ms and the SysTick count elapsed in the current ms so that
+ * they belong together.
+ * If the SysTick reloaded but its interrupt did not run yet (we are in ISR or with
+ * interrupts disabled), the ms is incremented here and the count is re-read after the reload.
+ * If the interrupt runs while reading, the values are read again.
+ * Returns the lower 32 bits of the time in ms. */
+static uint32_t wmsf_systick_snapshot(uint32_t* ms_hi, uint32_t* elapsed)
+{
+	uint32_t ms, hi, val, carry;
+	
+	do 
+	{
+		ms = gmsf_systime;
+		hi = gmsf_systime_hi;
+		val = SysTick->VAL;
+		carry = 0;
+		if ( SCB->ICSR & SCB_ICSR_PENDSTSET_Msk )
+		{
+			val = SysTick->VAL;		/* surely after the reload */
+			carry = 1;
+		}
+	} while ( ms != gmsf_systime );
+	
+	ms += carry;
+	if ( carry && ms == 0 )
+		hi++;
+	if ( ms_hi )
+		*ms_hi = hi;
+	*elapsed = SysTick->LOAD - val;
+	return ms;
+}
+
+/* Advance the system time by 1 ms */
+static inline void wmsf_systime_tick(void)
 {
     /* global system time */
-    gmsf_systime++; 
+    if ( ++gmsf_systime == 0 )
+    	gmsf_systime_hi++;
+
+#if MSF_SWTIMER_API
+    wmsf_swtimer_tick();
+#endif
     
     /* Decrement to zero the counter used by the msf_delay_ms */
     if (gmsf_delaycnt != 0u)
@@ -263,6 +672,37 @@ void SysTick_Handler (void)
     }
 }
 
+/* Handler for the SysTick interrupt.
+The name of the function is pre-defined by CMSIS */
+void SysTick_Handler (void)
+{
+	wmsf_systime_tick();
+}
+
+#if MSF_LOWPOWER
+/* Add the time when the SysTick was stopped (the CPU was in stop mode) to the system time. 
+ * Called by msf_lowpower_sleep with the time measured by the LPTMR. 
+ * The time is added in one step; the software timers which expired fire now, once each. */
+void wmsf_systime_advance(uint32_t ms)
+{
+	uint32_t old;
+
+	MSF_ATOMIC_BEGIN();
+	old = gmsf_systime;
+	gmsf_systime += ms;
+	if ( gmsf_systime < old )
+		gmsf_systime_hi++;
+	gmsf_delaycnt = (gmsf_delaycnt > ms) ? (gmsf_delaycnt - ms) : 0;
+	MSF_ATOMIC_END();
+
+#if MSF_SWTIMER_API
+	/* outside the atomic section; it calls the timer handlers */
+	wmsf_swtimer_advance(ms);
+#endif
+}
+#endif	/* MSF_LOWPOWER */
+#endif	/* MSF_TICKLESS */
+
   
 
 
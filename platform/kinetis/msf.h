@@ -58,6 +58,7 @@ extern "C" {
 #define     MSF_ERROR_NOINIT        (7)     /**< device was not properly initialized */
 #define     MSF_ERROR_CONFIG        (8)     /**< driver not properly configured; e.g. invalid pins defined in msf_config.h */
 #define     MSF_ERROR_TIMEOUT       (9)     /**< the operation timed out */
+#define     MSF_ERROR_FULL          (10)    /**< there is no free space, e.g. in a table of callbacks */
 
 #define		MSF_ERROR_LAST			(100)	/**< helper constant; the last error code used by MSF globally. */
 
@@ -133,18 +134,59 @@ uint32_t    msf_millis(void);
  */
 uint32_t    msf_micros(void);
 
+/** @brief Get the number of milliseconds that elapsed since the CPU started as 64-bit number.
+ * @return number of milliseconds; it does not overflow in practice.
+ **/
+uint64_t    msf_millis64(void);
+
+/** @brief Get the number of microseconds that elapsed since the CPU started as 64-bit number.
+ * @return number of microseconds; it does not overflow in practice.
+ * @note The value is consistent with msf_micros (the lower 32 bits are the same).
+ */
+uint64_t    msf_micros64(void);
+
+/** @brief Get the number of CPU clock ticks that elapsed since the CPU started.
+ * @return number of ticks of the SysTick timer (CPU clock); it does not overflow in practice.
+ * @note This is the time with the best resolution available; use it for measuring
+ * short intervals.
+ */
+uint64_t    msf_ticks64(void);
+
+/** @brief Get the lower 32 bits of msf_ticks64.
+ * @return number of ticks of the SysTick timer (CPU clock); bus clock ticks in tickless mode.
+ * The value overflows in about 89 s at 48 MHz.
+ * @note It uses only 32-bit arithmetic, so it is cheap enough to time-stamp events
+ * in interrupt handlers, e.g. for measuring latency.
+ */
+uint32_t    msf_ticks32(void);
+
 /** @brief Stop the execution for given number of microseconds using busy-wait loop.
  * @param  micros number of microseconds for which the program should wait
  * @return none
  */
 void        msf_delay_us(uint32_t micros);
-/** @brief Stop the execution for given number of milliseconds using busy-wait loop.
+/** @brief Stop the execution for given number of milliseconds.
  * @param  millis number of milliseconds for which the program should wait
  * @return none
- * @note We rely on the CMSIS SysTick service 
+ * @note We rely on the CMSIS SysTick service.
+ * By default this is busy-wait loop. If MSF_DELAY_SLEEP is 1 in msf_config.h, the CPU sleeps 
+ * (WFI) until the next interrupt while waiting, or the idle hook (msf_set_idle_hook) is called. 
  */ 
 void        msf_delay_ms(uint32_t millis);
 
+/** User-defined function which is called while msf_delay_ms waits.
+The prototype is: void some_func(void);   
+*/
+typedef void (*MSF_IDLE_HOOK)(void);
+
+/** @brief Register function to be called repeatedly while msf_delay_ms waits.
+ * @param hook the function or null to sleep (WFI) instead
+ * @note Used only if MSF_DELAY_SLEEP is 1. The hook lets pending work run during delays, e.g.
+ * it can call sched_dispatch. It should return quickly; the delay ends only after it returns.
+ * If the hook calls msf_delay_ms, that delay does not call the hook again.
+ */
+void        msf_set_idle_hook(MSF_IDLE_HOOK hook);
+
 /** @}*/
 
 #endif /* MSF_TIME_API */
@@ -155,14 +197,110 @@ void        msf_delay_ms(uint32_t millis);
 *****************************************************/
 #if MSF_SHORT_DELAY_API
 /* Very short delay functions - implemented as inline functions in delay_util.h.  */
-/* MSF_DELAY_xUS	- Wait x microseconds. X may be 1, 5, 10, etc.
-The available values of X depend on F_CPU. See the included file for the 
-actually available functions for your device (F_CU in fact) */
+/* MSF_DELAY_xUS	- Wait x microseconds. X may be 1, 5 or 10.
+MSF_DELAY_US(x) - Wait x microseconds; x is any compile-time constant. 
+msf_delay_cycles(n) - Wait n CPU cycles; n is compile-time constant.
+The loops are generated for the F_CPU, so they are available for any CPU clock. */
 #include "delay_util.h"
 
+#if MSF_DELAY_SELFTEST
+/** @brief Measure the short delays with the SysTick timer and compare them with the 
+ * expected number of CPU cycles.
+ * @return number of delays which do not take the expected time; 0 if all are OK.
+ * @details Checks msf_delay_cycles for each way the loop is generated, the MSF_DELAY_xUS 
+ * functions and msf_delay_us (with tolerance of 2 loops). Call it once after msf_init, 
+ * e.g. after changing the compiler or the flash settings, which can add wait states.
+ * The SysTick runs with its full 24-bit period during the test, so the system time stops
+ * for the duration of the test (about 1.5 million CPU cycles).
+ * Enable it by defining MSF_DELAY_SELFTEST as 1 in msf_config.h.
+ */
+uint8_t		msf_delay_selftest(void);
+#endif
+
 #endif  /* MSF_SHORT_DELAY_API */
 
 
+/*****************************************************
+* Functions for changing the CPU clock in runtime
+*****************************************************/
+#if MSF_CLOCK_SWITCH
+/** @defgroup group_msf_clock MSF CPU clock switching
+* @details MSF functions for changing the CPU clock while the program runs. 
+* Implemented in msf_clock.c.<br>
+* The program starts with the F_CPU clock (48 MHz). It can drop to 8 or 4 MHz when there is
+* little work to save power and go back to 48 MHz under load. The MCG stays locked to the 
+* external crystal, so the switching takes only a few microseconds (back to 48 MHz it waits 
+* for the PLL to lock, about 0.5 ms).<br>
+* After the switch the SysTick is set for the new clock, so msf_millis, msf_micros, msf_delay_ms, 
+* msf_delay_us and the software timers keep the right time. The drivers which use the bus clock 
+* (UART1, UART2 and ADC) are notified and set their dividers for the new clock. 
+* The UART0 and the TPM timers are clocked from the crystal (OSCERCLK), which does not change.<br>
+* Before the switch the drivers are asked if they can work with the new clock; if the UART1/2
+* baudrate would differ by more than MSF_CLOCK_BAUD_TOLERANCE, the switch is refused.<br>
+* The program can register its own function to be notified by msf_clock_notify_add.<br>
+* <b>Limits</b><br>
+* - The delays generated in compile time (MSF_DELAY_US, MSF_DELAY_xUS, msf_delay_cycles)
+* are computed for F_CPU, so they take 6 or 12 times longer at 8 or 4 MHz.<br>
+* - The UART1/2 cannot reach the high baudrates (38400 and more) with 4 or 8 MHz bus clock
+* precisely enough; msf_clock_set refuses such clock while the UART is initialized.<br>
+* - Switch the clock when no transfer or conversion is in progress; the character 
+* being sent or received while the baudrate changes is lost.<br>
+* - msf_ticks64 counts the CPU clock cycles, so it counts slower at lower clock.
+* @{
+*/
+
+/** The CPU clock modes */
+typedef enum
+{
+	msf_clock_48mhz,	/**< 48 MHz CPU, 24 MHz bus; PLL (PEE mode); the default F_CPU */
+	msf_clock_8mhz,		/**< 8 MHz CPU and bus; the crystal directly (BLPE mode) */
+	msf_clock_4mhz,		/**< 4 MHz CPU and bus; the crystal divided by 2 (BLPE mode) */
+	
+} MSF_clock_mode;
+
+/** User-defined function which is called before and after the clock is changed.
+The prototype is: uint8_t some_func(uint32_t bus_clock, bool check);
+bus_clock is the new bus clock in Hz; the CPU clock is in SystemCoreClock.
+With check true it is called before the switch; return MSF_ERROR_OK if your device can
+work with bus_clock or an error code to refuse the switch. 
+With check false the clock was changed; set your device for it (the return value is ignored).
+*/
+typedef uint8_t (*MSF_CLOCK_NOTIFY)(uint32_t bus_clock, bool check);
+
+/** @brief Switch the CPU clock.
+ * @param mode the new clock mode
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the mode is not valid;
+ *  the error code of the registered function which refused the clock (e.g. MSF_ERROR_NOTSUPPORTED
+ *  from UART1/2 whose baudrate cannot be set precisely enough); the clock is not changed then.
+ * @note The registered functions are called with the interrupts disabled right after 
+ * the switch, so they should be short. 
+ */
+uint8_t		msf_clock_set(MSF_clock_mode mode);
+
+/** @brief Get the current clock mode. */
+MSF_clock_mode	msf_clock_get(void);
+
+/** @brief Get the current bus clock in Hz. 
+ * @note The CPU clock is in the CMSIS variable SystemCoreClock. */
+uint32_t	msf_clock_bus(void);
+
+/** @brief Register function to be called after each clock switch.
+ * @param func the function
+ * @return MSF_ERROR_OK (0) if OK (also if the function is already registered); 
+ *  MSF_ERROR_FULL if there is no free place (see MSF_CLOCK_NOTIFY_MAX); MSF_ERROR_ARGUMENT if func is null.
+ */
+uint8_t		msf_clock_notify_add(MSF_CLOCK_NOTIFY func);
+
+/** @brief Remove function registered by msf_clock_notify_add. */
+void		msf_clock_notify_remove(MSF_CLOCK_NOTIFY func);
+
+/* Internal function called by msf_clock_set; sets the SysTick for the new CPU clock */
+void		wmsf_systime_retime(uint32_t cpu_clock);
+
+/** @}*/
+#endif	/* MSF_CLOCK_SWITCH */
+
+
 
 /*****************************************************
 * Functions for reading and writing to SCI 
@@ -262,6 +400,34 @@ bool msf_char_available(void);
      * See the Analog_pin_t enum in msf_<device>.h for the analog pin definitions   
      */
 	uint16_t msf_analog_read(Analog_pin_t apin);
+	
+	/** @brief Measure the internal bandgap reference and compute the constants for 
+	 * converting the ADC readings to millivolts. 
+	 * @return the ADC reference voltage (VREFH; on FRDM-KL25Z this is the VDD) in mV.
+	 * @details The result of the ADC conversion depends on the reference voltage 
+	 * which is usually the power supply voltage, so it changes with the supply. This function 
+	 * measures the bandgap reference (1 V) and stores the conversion constants, so
+	 * that msf_analog_read_mv and msf_analog_read_temperature can compensate for the 
+	 * supply voltage using integer math only. 
+	 * It is called automatically on the first call of those functions. Call it again 
+	 * if the supply voltage may change (e.g. battery discharging) or after changing the ADC 
+	 * resolution or reference.
+	 */
+	uint16_t msf_analog_vdd_update(void);
+	
+	/** @brief Read analog value from given analog pin in millivolts.
+	 * @param apin analog pin; single-ended input only (not AIN_DIFF_...) 
+	 * @return the voltage on the pin in mV.
+	 * @note The value is computed using the constants obtained by msf_analog_vdd_update.
+	 */
+	uint16_t msf_analog_read_mv(Analog_pin_t apin);
+	
+	/** @brief Read the internal temperature sensor.
+	 * @return the temperature in 0.1 degree C, e.g. 253 means 25.3 C.
+	 * @note The accuracy is low (several degrees) because the typical values of the sensor 
+	 * from datasheet are used. 
+	 */
+	int16_t msf_analog_read_temperature(void);
 /** @}*/
 #endif /* MSF_ANALOG_API */
 
@@ -269,34 +435,73 @@ bool msf_char_available(void);
 
 /*****************************************************
 * Functions for software timer
-* NOTE: not implemented for Kinetis yet!
 *****************************************************/
 #if MSF_SWTIMER_API
 /** @defgroup group_msf_swtimer MSF software timer  
-* @details MSF software timer functions
+* @details MSF software timer functions. 
+* The timers are periodic; the callback is called every period ms until the timer is 
+* stopped. The timers are kept in a timing wheel advanced in the SysTick interrupt, so
+* starting, stopping and firing a timer takes the same time regardless of how many timers exist.<br>
+* By default the callbacks are called from the SysTick interrupt, so they must be short. 
+* If MSF_SWTIMER_DEFERRED is 1 in msf_config.h, they are called from msf_timer_poll, which
+* should be called from the main loop.<br>
+* The MSF_TIMER variables must be global or static (initialized to zero) and must exist 
+* as long as the timer is used.
 * @{
 */
 /* Software timer support 
- Implemented in sw_timer.c */
+ Implemented in msf_swtimer.c */
 /** User-defined function which is called when timer fires.
 The prototype is: void some_func(void);   
 */
 typedef void (*MSF_TIMER_FUNC)(void);
 
-/** @brief Software timer data */
+/** @brief Software timer data 
+ * @note Do not access the members directly; use the msf_timer_ functions. */
 typedef struct msf_sw_timer 
 {
+   uint32_t         expires;    /**< the time of the next expiration (internal) */
    uint16_t         period;    /**< time in ms for the timer to fire */
-   uint16_t         cnt;        /**< helper variable */
+   uint8_t          state;      /**< active, pending (internal) */
    MSF_TIMER_FUNC   handler;    /**< user routine to call when timer fires */
-   struct msf_sw_timer* next; /**< pointer to next element in list */ 
+   struct msf_sw_timer* next; /**< pointer to next timer in the same slot of the wheel */ 
+   struct msf_sw_timer** pprev; /**< pointer to the pointer to this timer in the wheel */
+   struct msf_sw_timer* pending; /**< pointer to next timer whose callback should be called */
 } MSF_TIMER;
 
+/** @brief Start periodic timer.
+ * @param tdata pointer to the timer data
+ * @param period the period in ms; 1 thru 65535
+ * @param callback the function to call when the timer fires
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the parameters are not valid. 
+ * @note If the timer is running, it is started again with the new period and callback.
+ */
 uint8_t     msf_timer_set(MSF_TIMER* tdata, uint16_t period, MSF_TIMER_FUNC callback);
+
+/** @brief Stop the timer and forget its callback; msf_timer_restart cannot be used then. */
 void        msf_timer_kill(MSF_TIMER* tdata);
+
+/** @brief Stop the timer; it can be started again by msf_timer_restart. */
 void        msf_timer_stop(MSF_TIMER* tdata);
+
+/** @brief Start stopped (or running) timer again; the period is counted from now.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_NOINIT if the timer was not set (or was killed). 
+ */
 uint8_t     msf_timer_restart(MSF_TIMER* tdata);
 
+#if MSF_SWTIMER_DEFERRED
+/** @brief Call the callbacks of the timers which fired since the last call.
+ * @return the number of callbacks called.
+ * @note If a timer fires more than once before this function is called, 
+ * its callback is called only once.
+ */
+uint8_t     msf_timer_poll(void);
+#endif
+
+/* Internal functions called from the SysTick interrupt and after the stop mode */
+void        wmsf_swtimer_tick(void);
+void        wmsf_swtimer_advance(uint32_t ms);
+
 /** @}*/
 #endif    /* MSF_SWTIMER_API */
 
@@ -310,6 +515,104 @@ typedef enum
 } MSF_power_state;
 
 
+/*****************************************************
+* Low-power manager
+*****************************************************/
+#if MSF_LOWPOWER
+/** @defgroup group_msf_lowpower MSF low-power manager  
+* @details MSF functions for putting the CPU into the stop modes. Implemented in msf_lowpower.c.<br>
+* msf_lowpower_sleep waits for an interrupt in the deepest mode which all the drivers allow:<br>
+* - wait: the CPU stops, all the peripherals run; some driver needs the bus clock.<br>
+* - VLPS (very low power stop): the bus clock stops; the peripherals with their own clock 
+* (UART0 and TPM from the crystal, LPTMR) run and wake up the CPU by their interrupts.
+* Needs several uA plus the peripherals.<br>
+* - LLS (low leakage stop): only the LPTMR and the LLWU wake-up pins (msf_lowpower_wakeup_pin) 
+* can wake up the CPU. Needs about 2 uA.<br>
+* Each driver votes by its power state (PowerControl): msf_power_full allows only wait, 
+* msf_power_low allows VLPS (the driver wakes up the CPU, e.g. the UART when a character comes), 
+* msf_power_off allows LLS. The program can vote too with MSF_LP_USER(n).<br>
+* The SysTick stops in the stop modes; the time spent in stop mode is measured by the LPTMR
+* (1 kHz LPO, accurate to few per cent) and added to the system time after the wake-up,
+* so the software timers fire late, after the wake-up.<br>
+* <b>Howto use the low-power manager</b><br>
+* 1) Set MSF_LOWPOWER to 1 in msf_config.h.<br>
+* 2) Set the drivers which are not needed while sleeping to msf_power_off and the ones which should 
+* wake up the CPU to msf_power_low, e.g. Driver_UART0.PowerControl(msf_power_low).<br>
+* 3) In the main loop, when there is nothing to do, call msf_lowpower_sleep(100).<br>
+* 4) Set the drivers back to msf_power_full before using them.<br>
+* @{
+*/
+
+/** The sleep modes; from the lightest to the deepest */
+typedef enum
+{
+	msf_sleep_wait,		/**< wait mode; the CPU clock stops */
+	msf_sleep_vlps,		/**< very low power stop; the bus clock stops */
+	msf_sleep_lls,		/**< low leakage stop; only LLWU sources wake up */
+	
+} MSF_sleep_mode;
+
+/** The clients of the low-power manager; each has one bit in the votes */
+#define		MSF_LP_UART0		(1UL << 0)
+#define		MSF_LP_UART1		(1UL << 1)
+#define		MSF_LP_UART2		(1UL << 2)
+#define		MSF_LP_ADC0			(1UL << 3)
+#define		MSF_LP_TPM0			(1UL << 4)
+#define		MSF_LP_TPM1			(1UL << 5)
+#define		MSF_LP_TPM2			(1UL << 6)
+#define		MSF_LP_USER(n)		(1UL << (8 + (n)))	/**< for the program; n = 0 thru 23 */
+
+/** The edges for msf_lowpower_wakeup_pin */
+#define		MSF_LP_EDGE_NONE	(0)		/**< the pin does not wake up */
+#define		MSF_LP_EDGE_RISING	(1)
+#define		MSF_LP_EDGE_FALLING	(2)
+#define		MSF_LP_EDGE_ANY		(3)
+
+/** @brief Set the deepest sleep mode allowed by the client.
+ * @param client one of the MSF_LP_ constants
+ * @param deepest the deepest mode the client can work with
+ * @note The drivers vote from their Initialize and PowerControl functions.
+ */
+void		msf_lowpower_vote(uint32_t client, MSF_sleep_mode deepest);
+
+/** @brief Request the crystal oscillator (OSCERCLK) to run in the stop modes or release the request.
+ * @param client one of the MSF_LP_ constants
+ * @param needed true if the client needs the oscillator in the stop modes
+ * @note The oscillator runs in the stop modes while at least one client needs it, 
+ * or always if MSF_LOWPOWER_FAST_WAKE is 1. The UART0 and TPM drivers request it
+ * in msf_power_low state.
+ */
+void		msf_lowpower_oscer(uint32_t client, bool needed);
+
+/** @brief Get the deepest sleep mode allowed by all the clients. */
+MSF_sleep_mode	msf_lowpower_allowed(void);
+
+/** @brief Wait for interrupt in the deepest allowed sleep mode.
+ * @param max_ms the longest time to sleep in ms, 1 thru 65535; the LPTMR wakes up the CPU then.
+ *  0 = sleep until an interrupt (the LPTMR wakes up the CPU after 65.5 s anyway to keep the time).
+ * @return the mode used
+ * @note Returns after the interrupt handler which woke up the CPU has been executed.
+ */
+MSF_sleep_mode	msf_lowpower_sleep(uint32_t max_ms);
+
+/** @brief Enable the LLWU pin to wake up the CPU from LLS.
+ * @param llwu_pin the number of the LLWU pin. On KL25 these are: 5 = PTB0, 6 = PTC1, 7 = PTC3, 
+ *  8 = PTC4, 9 = PTC5, 10 = PTC6, 14 = PTD4, 15 = PTD6.
+ * @param edge the edge which wakes up, MSF_LP_EDGE_...; MSF_LP_EDGE_NONE disables the pin.
+ * @return MSF_ERROR_OK (0) if OK; MSF_ERROR_ARGUMENT if the pin is not LLWU pin.
+ * @note Configure the pin as GPIO input (msf_pin_direction) first.
+ * In VLPS and wait mode the pin does not wake up; use the port interrupt for them.
+ */
+uint8_t		msf_lowpower_wakeup_pin(uint8_t llwu_pin, uint8_t edge);
+
+/* Internal functions */
+void		wmsf_lowpower_init(void);
+void		wmsf_systime_advance(uint32_t ms);
+
+/** @}*/
+#endif	/* MSF_LOWPOWER */
+
+
 #ifdef __cplusplus
 }
 #endif
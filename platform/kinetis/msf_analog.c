@@ -21,6 +21,14 @@
 /* Define which driver (instance of the ADC) is used by us */
 #define	 MSF_ANALOG_DRIVER	Driver_ADC0
 
+#if (MSF_USE_ANALOG)
+/* Constants for converting the ADC result to mV and 0.1 mV; computed from
+ * the bandgap reading by msf_analog_vdd_update. 
+ * Voltage = (result * scale) >> 16 */
+static uint32_t gmsf_analog_scale_mv;
+static uint32_t gmsf_analog_scale_mv10;
+#endif
+
 
 #if (MSF_USE_ANALOG)
     /* Read analog value from given analog pin */
@@ -57,4 +65,45 @@
 #endif
  }
  
+ /* Measure the bandgap and compute the constants for converting to mV */
+ uint16_t msf_analog_vdd_update(void)
+ {
+	 uint32_t bandgap;
+	 
+	 /* The first reading after enabling the bandgap buffer may not be correct */
+	 msf_analog_read(AIN_BANDGAP);
+	 bandgap = msf_analog_read(AIN_BANDGAP);
+	 if ( bandgap == 0 )
+		 return 0;
+	 
+	 /* These are the only divisions; the conversions then use multiplication and shift */ 
+	 gmsf_analog_scale_mv = ((uint32_t)WMSF_ADC_BANDGAP_MV << 16) / bandgap;
+	 gmsf_analog_scale_mv10 = ((uint32_t)WMSF_ADC_BANDGAP_MV * 10 << 16) / bandgap;
+	 
+	 /* The VREFH channel gives the full-scale value, i.e. the reference voltage */
+	 return (uint16_t)((msf_analog_read(AIN_VREFH) * gmsf_analog_scale_mv) >> 16); 
+ }
+ 
+ /* Read analog value in mV */
+ uint16_t msf_analog_read_mv(Analog_pin_t apin)
+ {
+	 if ( gmsf_analog_scale_mv == 0 )
+		 msf_analog_vdd_update();
+	 
+	 return (uint16_t)((msf_analog_read(apin) * gmsf_analog_scale_mv) >> 16);
+ }
+ 
+ /* Read temperature in 0.1 C */
+ int16_t msf_analog_read_temperature(void)
+ {
+	 int32_t mv10;
+	 
+	 if ( gmsf_analog_scale_mv10 == 0 )
+		 msf_analog_vdd_update();
+	 
+	 /* temperature = 25 - (Vtemp - Vtemp25) / slope */
+	 mv10 = (int32_t)((msf_analog_read(AIN_TEMPERATURE) * gmsf_analog_scale_mv10) >> 16);
+	 return (int16_t)(250 - (((mv10 - WMSF_ADC_TEMP25_MV10) * WMSF_ADC_TEMP_SLOPE_MUL) >> 16));
+ }
+ 
 #endif
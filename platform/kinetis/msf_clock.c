@@ -0,0 +1,182 @@
+/****************************************************************************
+ * @file     msf_clock.c
+ * @brief    Switching the CPU clock in runtime - MSF global functions
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note Prototypes of these functions are in msf.h
+ *      The MCG starts in PEE mode (PLL locked to the 8 MHz crystal) set by the
+ *      CMSIS SystemInit with CLOCK_SETUP 1. For the lower clocks the MCG goes
+ *      to BLPE mode (the crystal drives the CPU directly, the PLL is off); 
+ *      see the MCG mode state diagram in the KL25 Reference manual.
+ *
+ ******************************************************************************/
+
+#include "msf_config.h"
+
+/* Include hardware definitions */
+#include "coredef.h"
+
+#include "msf.h"
+
+#if MSF_CLOCK_SWITCH
+
+#if F_CPU != 48000000
+	#error "The CPU clock switching requires F_CPU 48 MHz (CLOCK_SETUP 1 in system_MKL25Z4.c)"
+#endif
+
+/* Values of the MCG_S_CLKST for the clock sources */
+#define		WMSF_CLKST_EXTERNAL		(2)
+#define		WMSF_CLKST_PLL			(3)
+
+/* The clocks and the dividers for each MSF_clock_mode */
+typedef struct 
+{
+	uint32_t	cpu_clock;
+	uint32_t	bus_clock;
+	uint32_t	clkdiv;		/* the value for SIM_CLKDIV1 */
+} WMSF_CLOCK_MODE;
+
+static const WMSF_CLOCK_MODE gmsf_clock_modes[] = 
+{
+	/* msf_clock_48mhz: PLL 96 MHz / 2; bus = core / 2 */
+	{ 48000000u, 24000000u, SIM_CLKDIV1_OUTDIV1(1) | SIM_CLKDIV1_OUTDIV4(1) },
+	/* msf_clock_8mhz: crystal 8 MHz / 1; bus = core */
+	{  8000000u,  8000000u, SIM_CLKDIV1_OUTDIV1(0) | SIM_CLKDIV1_OUTDIV4(0) },
+	/* msf_clock_4mhz: crystal 8 MHz / 2; bus = core */
+	{  4000000u,  4000000u, SIM_CLKDIV1_OUTDIV1(1) | SIM_CLKDIV1_OUTDIV4(0) },
+};
+
+/* The current clock mode */
+static MSF_clock_mode gmsf_clock_mode = msf_clock_48mhz;
+
+/* The functions to call after the clock switch */
+static MSF_CLOCK_NOTIFY gmsf_clock_notify[MSF_CLOCK_NOTIFY_MAX];
+
+
+/** @addtogroup group_msf_clock
+* @{
+*/
+
+/* Switch the CPU clock */
+uint8_t msf_clock_set(MSF_clock_mode mode)
+{
+	const WMSF_CLOCK_MODE* clk;
+	uint8_t i, err;
+	
+	if ( (uint32_t)mode >= (sizeof(gmsf_clock_modes) / sizeof(gmsf_clock_modes[0])) )
+		return MSF_ERROR_ARGUMENT;
+	if ( mode == gmsf_clock_mode )
+		return MSF_ERROR_OK;
+	
+	clk = &gmsf_clock_modes[mode];
+	/* ask the drivers first; any of them can refuse the new clock */
+	for ( i = 0; i < MSF_CLOCK_NOTIFY_MAX; i++ )
+	{
+		if ( gmsf_clock_notify[i] != null )
+		{
+			err = gmsf_clock_notify[i](clk->bus_clock, true);
+			if ( err != MSF_ERROR_OK )
+				return err;
+		}
+	}
+	
+	if ( mode == msf_clock_48mhz )
+	{
+		/* BLPE -> PBE: enable the PLL and wait until it locks (about 0.5 ms); 
+		 * the CPU still runs from the crystal, so the interrupts can stay enabled */
+		MCG->C2 &= ~MCG_C2_LP_MASK;
+		while ( (MCG->S & MCG_S_LOCK0_MASK) == 0 )
+			;
+	}
+	
+	MSF_ATOMIC_BEGIN();
+	if ( mode == msf_clock_48mhz )
+	{
+		/* PBE -> PEE: set the dividers first, so that the CPU and bus clocks 
+		 * do not exceed the limits after the switch to the PLL */
+		SIM->CLKDIV1 = clk->clkdiv;
+		MCG->C1 &= ~MCG_C1_CLKS_MASK;
+		while ( (MCG->S & MCG_S_CLKST_MASK) != MCG_S_CLKST(WMSF_CLKST_PLL) )
+			;
+	}
+	else
+	{
+		if ( gmsf_clock_mode == msf_clock_48mhz )
+		{
+			/* PEE -> PBE: the crystal drives the CPU; then PBE -> BLPE: disable the PLL */
+			MCG->C1 = (MCG->C1 & ~MCG_C1_CLKS_MASK) | MCG_C1_CLKS(WMSF_CLKST_EXTERNAL);
+			while ( (MCG->S & MCG_S_CLKST_MASK) != MCG_S_CLKST(WMSF_CLKST_EXTERNAL) )
+				;
+			MCG->C2 |= MCG_C2_LP_MASK;
+		}
+		/* the dividers after the switch; the clocks only go down */
+		SIM->CLKDIV1 = clk->clkdiv;
+	}
+	
+	gmsf_clock_mode = mode;
+	SystemCoreClock = clk->cpu_clock;
+	wmsf_systime_retime(clk->cpu_clock);
+	
+	for ( i = 0; i < MSF_CLOCK_NOTIFY_MAX; i++ )
+	{
+		if ( gmsf_clock_notify[i] != null )
+			gmsf_clock_notify[i](clk->bus_clock, false);
+	}
+	MSF_ATOMIC_END();
+	
+	return MSF_ERROR_OK;
+}
+
+/* Get the current clock mode */
+MSF_clock_mode msf_clock_get(void)
+{
+	return gmsf_clock_mode;
+}
+
+/* Get the current bus clock */
+uint32_t msf_clock_bus(void)
+{
+	return gmsf_clock_modes[gmsf_clock_mode].bus_clock;
+}
+
+/* Register function to be called after the clock switch */
+uint8_t msf_clock_notify_add(MSF_CLOCK_NOTIFY func)
+{
+	uint8_t i, free_index = MSF_CLOCK_NOTIFY_MAX;
+	
+	if ( func == null )
+		return MSF_ERROR_ARGUMENT;
+	
+	MSF_ATOMIC_BEGIN();
+	for ( i = 0; i < MSF_CLOCK_NOTIFY_MAX; i++ )
+	{
+		if ( gmsf_clock_notify[i] == func )
+			free_index = i;		/* already registered */
+		else if ( gmsf_clock_notify[i] == null && free_index == MSF_CLOCK_NOTIFY_MAX )
+			free_index = i;
+	}
+	if ( free_index < MSF_CLOCK_NOTIFY_MAX )
+		gmsf_clock_notify[free_index] = func;
+	MSF_ATOMIC_END();
+	
+	return (free_index < MSF_CLOCK_NOTIFY_MAX) ? MSF_ERROR_OK : MSF_ERROR_FULL;
+}
+
+/* Remove function registered by msf_clock_notify_add */
+void msf_clock_notify_remove(MSF_CLOCK_NOTIFY func)
+{
+	uint8_t i;
+	
+	MSF_ATOMIC_BEGIN();
+	for ( i = 0; i < MSF_CLOCK_NOTIFY_MAX; i++ )
+	{
+		if ( gmsf_clock_notify[i] == func )
+			gmsf_clock_notify[i] = null;
+	}
+	MSF_ATOMIC_END();
+}
+
+/** @}*/
+
+#endif	/* MSF_CLOCK_SWITCH */
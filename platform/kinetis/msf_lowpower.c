@@ -0,0 +1,223 @@
+/****************************************************************************
+ * @file     msf_lowpower.c
+ * @brief    Low-power manager - MSF global functions
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note Prototypes of these functions are in msf.h
+ *      The drivers vote for the deepest stop mode they can work with;
+ *      msf_lowpower_sleep enters the deepest mode allowed by all of them.
+ *      The LPTMR (1 kHz LPO) runs in all the stop modes; it limits the sleep
+ *      time and measures it, because the SysTick stops.
+ *      See the Power management chapter in the KL25 Reference manual.
+ *
+ ******************************************************************************/
+
+#include "msf_config.h"
+
+/* Include hardware definitions */
+#include "coredef.h"
+
+#include "msf.h"
+
+/* freqcnt.c defines its own LPTimer_IRQHandler if FREQCNT_USE_LPTMR is set */
+#if MSF_LOWPOWER && FREQCNT_USE_LPTMR
+	#error MSF_LOWPOWER uses the LPTMR; it cannot be used together with FREQCNT_USE_LPTMR.
+#endif
+
+#if MSF_LOWPOWER
+
+/* The values of the SMC_PMCTRL_STOPM for the stop modes */
+#define		WMSF_STOPM_VLPS		(2)
+#define		WMSF_STOPM_LLS		(3)
+
+/* The longest time the LPTMR can count in ms */
+#define		WMSF_LP_MAX_MS		(65535u)
+
+/* The LLWU pins available on KL25: P5 - P10, P14, P15 */
+#define		WMSF_LLWU_PINS		(0xC7E0u)
+
+/* The clients which allow only wait mode and those which allow at most VLPS;
+ * the clients in neither allow LLS */
+static volatile uint32_t gmsf_lp_wait;
+static volatile uint32_t gmsf_lp_vlps;
+/* The clients which need the crystal oscillator (OSCERCLK) in the stop modes */
+static volatile uint32_t gmsf_lp_oscer;
+
+static uint32_t wmsf_lptmr_read(uint32_t max_ms);
+
+
+/** @addtogroup group_msf_lowpower
+* @{
+*/
+
+/* Set the deepest sleep mode allowed by the client */
+void msf_lowpower_vote(uint32_t client, MSF_sleep_mode deepest)
+{
+	MSF_ATOMIC_BEGIN();
+	gmsf_lp_wait &= ~client;
+	gmsf_lp_vlps &= ~client;
+	if ( deepest == msf_sleep_wait )
+		gmsf_lp_wait |= client;
+	else if ( deepest == msf_sleep_vlps )
+		gmsf_lp_vlps |= client;
+	MSF_ATOMIC_END();
+}
+
+/* Request the oscillator in the stop modes or release the request */
+void msf_lowpower_oscer(uint32_t client, bool needed)
+{
+	MSF_ATOMIC_BEGIN();
+	if ( needed )
+		gmsf_lp_oscer |= client;
+	else
+		gmsf_lp_oscer &= ~client;
+	
+	/* with MSF_LOWPOWER_FAST_WAKE it runs always (set in wmsf_lowpower_init) */
+	if ( gmsf_lp_oscer != 0 || MSF_LOWPOWER_FAST_WAKE )
+		OSC0->CR |= OSC_CR_EREFSTEN_MASK;
+	else
+		OSC0->CR &= ~OSC_CR_EREFSTEN_MASK;
+	MSF_ATOMIC_END();
+}
+
+/* Get the deepest sleep mode allowed by all the clients */
+MSF_sleep_mode msf_lowpower_allowed(void)
+{
+	if ( gmsf_lp_wait != 0 )
+		return msf_sleep_wait;
+	if ( gmsf_lp_vlps != 0 )
+		return msf_sleep_vlps;
+	return msf_sleep_lls;
+}
+
+/* Wait for interrupt in the deepest allowed mode */
+MSF_sleep_mode msf_lowpower_sleep(uint32_t max_ms)
+{
+	MSF_sleep_mode mode;
+	uint32_t slept;
+
+	if ( max_ms == 0 || max_ms > WMSF_LP_MAX_MS )
+		max_ms = WMSF_LP_MAX_MS;
+
+	/* The LPTMR limits the sleep; the counter is reset when it is disabled */
+	LPTMR0->CSR = 0;
+	LPTMR0->CMR = max_ms - 1;
+	LPTMR0->CSR = LPTMR_CSR_TCF_MASK | LPTMR_CSR_TIE_MASK | LPTMR_CSR_TEN_MASK;
+
+	/* The interrupts are disabled, so that the interrupt which comes just before the WFI
+	 * is not missed; the WFI wakes up on the pending interrupt anyway and its handler
+	 * runs after the MSF_ATOMIC_END. */
+	MSF_ATOMIC_BEGIN();
+	mode = msf_lowpower_allowed();
+	if ( mode == msf_sleep_wait )
+	{
+		SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+		__WFI();
+		slept = wmsf_lptmr_read(max_ms);
+	}
+	else
+	{
+		SMC->PMCTRL = (SMC->PMCTRL & ~SMC_PMCTRL_STOPM_MASK)
+				| SMC_PMCTRL_STOPM((mode == msf_sleep_vlps) ? WMSF_STOPM_VLPS : WMSF_STOPM_LLS);
+		(void)SMC->PMCTRL;		/* the write must complete before the WFI */
+		SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+		__WFI();
+		SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+		slept = wmsf_lptmr_read(max_ms);
+
+		/* The stop in PEE mode returns to PBE mode (the crystal drives the CPU);
+		 * wait until the PLL locks and switch back to it */
+		if ( (MCG->C1 & MCG_C1_CLKS_MASK) != 0 && (MCG->C6 & MCG_C6_PLLS_MASK)
+				&& (MCG->C2 & MCG_C2_LP_MASK) == 0 )
+		{
+			while ( (MCG->S & MCG_S_LOCK0_MASK) == 0 )
+				;
+			MCG->C1 &= ~MCG_C1_CLKS_MASK;
+			while ( (MCG->S & MCG_S_CLKST_MASK) != MCG_S_CLKST(3) )
+				;
+		}
+	}
+	MSF_ATOMIC_END();
+
+	/* The SysTick did not run in the stop modes */
+	if ( mode != msf_sleep_wait )
+		wmsf_systime_advance(slept);
+
+	return mode;
+}
+
+/* Enable the LLWU pin to wake up the CPU from LLS */
+uint8_t msf_lowpower_wakeup_pin(uint8_t llwu_pin, uint8_t edge)
+{
+	volatile uint8_t* pe;
+	uint8_t shift;
+
+	if ( llwu_pin > 15 || (WMSF_LLWU_PINS & (1u << llwu_pin)) == 0 || edge > MSF_LP_EDGE_ANY )
+		return MSF_ERROR_ARGUMENT;
+
+	/* 4 pins in each PEn register, 2 bits per pin */
+	pe = &LLWU->PE1 + (llwu_pin >> 2);
+	shift = (llwu_pin & 0x03) * 2;
+	*pe = (*pe & ~(0x03 << shift)) | (edge << shift);
+
+	return MSF_ERROR_OK;
+}
+
+/** @}*/
+
+/* Allow the stop modes and prepare the wake-up sources; called from msf_init */
+void wmsf_lowpower_init(void)
+{
+	/* The PMPROT can be written only once after reset */
+	SMC->PMPROT = SMC_PMPROT_AVLP_MASK | SMC_PMPROT_ALLS_MASK;
+
+#if MSF_LOWPOWER_FAST_WAKE
+	/* The oscillator runs in the stop modes */
+	OSC0->CR |= OSC_CR_EREFSTEN_MASK;
+#endif
+
+	/* LPTMR clocked by the 1 kHz LPO, no prescaler; it wakes up from LLS through the LLWU */
+	SIM->SCGC5 |= SIM_SCGC5_LPTMR_MASK;
+	LPTMR0->CSR = 0;
+	LPTMR0->PSR = LPTMR_PSR_PCS(1) | LPTMR_PSR_PBYP_MASK;
+	LLWU->ME = LLWU_ME_WUME0_MASK;
+
+	NVIC_ClearPendingIRQ(LPTimer_IRQn);
+	NVIC_EnableIRQ(LPTimer_IRQn);
+	NVIC_ClearPendingIRQ(LLW_IRQn);
+	NVIC_EnableIRQ(LLW_IRQn);
+}
+
+/* Get the time slept in ms and stop the LPTMR; called right after the wake-up 
+ * with the interrupts disabled, before the LPTMR handler clears the flag */
+static uint32_t wmsf_lptmr_read(uint32_t max_ms)
+{
+	uint32_t ms;
+
+	if ( LPTMR0->CSR & LPTMR_CSR_TCF_MASK )
+		ms = max_ms;
+	else
+	{
+		LPTMR0->CNR = 0;	/* the CNR must be written to latch the counter for reading */
+		ms = LPTMR0->CNR;
+	}
+	LPTMR0->CSR = 0;
+	return ms;
+}
+
+/* Interrupt handler for the LPTMR; it only wakes up the CPU */
+void LPTimer_IRQHandler(void)
+{
+	LPTMR0->CSR |= LPTMR_CSR_TCF_MASK;	/* clear the flag */
+}
+
+/* Interrupt handler for the LLWU; the wake-up from LLS by a pin.
+ * The module sources (LPTMR) are cleared in their own handlers. */
+void LLW_IRQHandler(void)
+{
+	LLWU->F1 = 0xFF;	/* write 1 to clear */
+	LLWU->F2 = 0xFF;
+}
+
+#endif	/* MSF_LOWPOWER */
@@ -0,0 +1,341 @@
+/****************************************************************************
+ * @file     msf_swtimer.c
+ * @brief    Software timers - MSF global functions
+ * @version  1
+ * @date     18. Oct. 2026
+ *
+ * @note Prototypes of these functions are in msf.h
+ *      The timers are kept in a hierarchical timing wheel which is advanced
+ *      every ms from the SysTick interrupt (see msf.c). Starting, stopping and
+ *      firing a timer takes constant time regardless of the number of timers.
+ *
+ ******************************************************************************/
+
+#include "msf_config.h"
+
+/* Include hardware definitions */
+#include "coredef.h"
+
+#include "msf.h"
+
+#if MSF_SWTIMER_API
+
+#if MSF_TICKLESS
+	#error "The software timers are driven by the SysTick; set MSF_SWTIMER_API to 0 in tickless mode"
+#endif
+
+/* The timing wheel: WMSF_SWT_LEVELS levels with WMSF_SWT_SLOTS slots each.
+ * Level 0 has 1 ms slots, level 1 has WMSF_SWT_SLOTS ms slots etc.
+ * 4 levels of 16 slots cover the whole range of the 16-bit period. */
+#define		WMSF_SWT_BITS		(4)
+#define		WMSF_SWT_SLOTS		(1 << WMSF_SWT_BITS)
+#define		WMSF_SWT_MASK		(WMSF_SWT_SLOTS - 1)
+#define		WMSF_SWT_LEVELS		(4)
+
+/* Values for the MSF_TIMER state */
+#define		WMSF_SWT_ACTIVE		(0x01)	/* the timer is in the wheel */
+#define		WMSF_SWT_PENDING	(0x02)	/* the timer is in the list for msf_timer_poll */
+
+/* Lists of timers for each slot of the wheel */
+static MSF_TIMER* gmsf_swt_wheel[WMSF_SWT_LEVELS][WMSF_SWT_SLOTS];
+/* The time of the wheel in ms; the last tick processed */
+static uint32_t gmsf_swt_now;
+
+#if MSF_SWTIMER_DEFERRED
+/* Timers which fired and wait for msf_timer_poll to call their handlers */
+static MSF_TIMER* gmsf_swt_pending;
+static MSF_TIMER* gmsf_swt_pending_last;
+#endif
+
+static void wmsf_swt_insert(MSF_TIMER* tdata);
+static void wmsf_swt_remove(MSF_TIMER* tdata);
+static void wmsf_swt_cascade(uint8_t level);
+static void wmsf_swt_fire(MSF_TIMER* tdata, MSF_TIMER** fired);
+static void wmsf_swt_call(MSF_TIMER* fired);
+
+
+/** @addtogroup group_msf_swtimer
+* @{
+*/
+
+/* Start periodic timer */
+uint8_t msf_timer_set(MSF_TIMER* tdata, uint16_t period, MSF_TIMER_FUNC callback)
+{
+	if ( tdata == null || callback == null || period == 0 )
+		return MSF_ERROR_ARGUMENT;
+
+	MSF_ATOMIC_BEGIN();
+	/* the timer may be running already */
+	if ( tdata->state & WMSF_SWT_ACTIVE )
+		wmsf_swt_remove(tdata);
+	tdata->period = period;
+	tdata->handler = callback;
+	tdata->expires = gmsf_swt_now + period;
+	wmsf_swt_insert(tdata);
+	MSF_ATOMIC_END();
+
+	return MSF_ERROR_OK;
+}
+
+/* Stop the timer and forget its callback */
+void msf_timer_kill(MSF_TIMER* tdata)
+{
+	if ( tdata == null )
+		return;
+
+	MSF_ATOMIC_BEGIN();
+	if ( tdata->state & WMSF_SWT_ACTIVE )
+		wmsf_swt_remove(tdata);
+	tdata->handler = null;
+	MSF_ATOMIC_END();
+}
+
+/* Stop the timer; it can be started again by msf_timer_restart */
+void msf_timer_stop(MSF_TIMER* tdata)
+{
+	if ( tdata == null )
+		return;
+
+	MSF_ATOMIC_BEGIN();
+	if ( tdata->state & WMSF_SWT_ACTIVE )
+		wmsf_swt_remove(tdata);
+	MSF_ATOMIC_END();
+}
+
+/* Start the timer again with its period counted from now */
+uint8_t msf_timer_restart(MSF_TIMER* tdata)
+{
+	if ( tdata == null || tdata->handler == null )
+		return MSF_ERROR_NOINIT;
+
+	MSF_ATOMIC_BEGIN();
+	if ( tdata->state & WMSF_SWT_ACTIVE )
+		wmsf_swt_remove(tdata);
+	tdata->expires = gmsf_swt_now + tdata->period;
+	wmsf_swt_insert(tdata);
+	MSF_ATOMIC_END();
+
+	return MSF_ERROR_OK;
+}
+
+#if MSF_SWTIMER_DEFERRED
+/* Call the handlers of the timers which fired since the last call */
+uint8_t msf_timer_poll(void)
+{
+	MSF_TIMER* t;
+	MSF_TIMER* next;
+	MSF_TIMER_FUNC handler;
+	uint8_t count = 0;
+
+	MSF_ATOMIC_BEGIN();
+	t = gmsf_swt_pending;
+	gmsf_swt_pending = null;
+	gmsf_swt_pending_last = null;
+	MSF_ATOMIC_END();
+
+	while ( t != null )
+	{
+		/* Once the pending flag is cleared, the timer can be added to the new list
+		 * by the interrupt, so its link must be read before */
+		MSF_ATOMIC_BEGIN();
+		next = t->pending;
+		t->state &= ~WMSF_SWT_PENDING;
+		/* the timer could be stopped or killed after it fired */
+		handler = (t->state & WMSF_SWT_ACTIVE) ? t->handler : null;
+		MSF_ATOMIC_END();
+
+		if ( handler != null )
+		{
+			handler();
+			count++;
+		}
+		t = next;
+	}
+
+	return count;
+}
+#endif	/* MSF_SWTIMER_DEFERRED */
+
+/** @}*/
+
+/* Advance the wheel by one ms and fire the timers which expire.
+ * Internal; called from the SysTick interrupt. */
+void wmsf_swtimer_tick(void)
+{
+	MSF_TIMER* t;
+	MSF_TIMER* fired;
+	MSF_TIMER* next;
+	uint8_t level;
+
+	gmsf_swt_now++;
+
+	/* At the start of each round of a level, move the timers of the next slot of the higher level
+	 * one level lower. Those which expire now end up in the current slot of level 0. */
+	for ( level = 1; level < WMSF_SWT_LEVELS; level++ )
+	{
+		if ( (gmsf_swt_now & ((1UL << (level * WMSF_SWT_BITS)) - 1)) != 0 )
+			break;
+		wmsf_swt_cascade(level);
+	}
+
+	/* All the timers in the current slot of level 0 expire now */
+	t = gmsf_swt_wheel[0][gmsf_swt_now & WMSF_SWT_MASK];
+	gmsf_swt_wheel[0][gmsf_swt_now & WMSF_SWT_MASK] = null;
+	fired = null;
+	while ( t != null )
+	{
+		next = t->next;
+		/* periodic timer - the next expiration is computed from the previous one, so that
+		 * the period does not drift if the handler is delayed */
+		t->expires += t->period;
+		wmsf_swt_insert(t);
+		wmsf_swt_fire(t, &fired);
+		t = next;
+	}
+
+	/* Call the handlers only after the wheel is updated, so that the handlers can
+	 * start and stop any timer */
+	wmsf_swt_call(fired);
+}
+
+/* Advance the wheel by given number of ms at once; each timer which expired
+ * in this time fires once and the periodic timers continue from the new time.
+ * Internal; called when the SysTick did not run (the CPU was in stop mode).
+ * The handlers are called with interrupts enabled. */
+void wmsf_swtimer_advance(uint32_t ms)
+{
+	MSF_TIMER* all = null;
+	MSF_TIMER* fired = null;
+	MSF_TIMER* t;
+	MSF_TIMER* next;
+	uint8_t level, slot;
+
+	if ( ms == 0 )
+		return;
+
+	MSF_ATOMIC_BEGIN();
+	/* Take all the timers out of the wheel... */
+	for ( level = 0; level < WMSF_SWT_LEVELS; level++ )
+	{
+		for ( slot = 0; slot < WMSF_SWT_SLOTS; slot++ )
+		{
+			t = gmsf_swt_wheel[level][slot];
+			gmsf_swt_wheel[level][slot] = null;
+			while ( t != null )
+			{
+				next = t->next;
+				t->next = all;
+				all = t;
+				t = next;
+			}
+		}
+	}
+
+	/* ...and put them back according to the new time */
+	gmsf_swt_now += ms;
+	while ( all != null )
+	{
+		t = all;
+		all = t->next;
+		if ( (int32_t)(t->expires - gmsf_swt_now) <= 0 )
+		{
+			t->expires = gmsf_swt_now + t->period;
+			wmsf_swt_insert(t);
+			wmsf_swt_fire(t, &fired);
+		}
+		else
+			wmsf_swt_insert(t);
+	}
+	MSF_ATOMIC_END();
+
+	wmsf_swt_call(fired);
+}
+
+
+/* Put the timer into the wheel according to its expiration time.
+ * Must be called with interrupts disabled. */
+static void wmsf_swt_insert(MSF_TIMER* tdata)
+{
+	uint32_t delta = tdata->expires - gmsf_swt_now;
+	uint8_t level = 0;
+	MSF_TIMER** slot;
+
+	/* the level whose slots are just long enough for the time remaining */
+	while ( level < (WMSF_SWT_LEVELS - 1) && delta >= (1UL << ((level + 1) * WMSF_SWT_BITS)) )
+		level++;
+	slot = &gmsf_swt_wheel[level][(tdata->expires >> (level * WMSF_SWT_BITS)) & WMSF_SWT_MASK];
+
+	tdata->next = *slot;
+	if ( *slot != null )
+		(*slot)->pprev = &tdata->next;
+	tdata->pprev = slot;
+	*slot = tdata;
+	tdata->state |= WMSF_SWT_ACTIVE;
+}
+
+/* Remove the timer from the wheel.
+ * Must be called with interrupts disabled. */
+static void wmsf_swt_remove(MSF_TIMER* tdata)
+{
+	*tdata->pprev = tdata->next;
+	if ( tdata->next != null )
+		tdata->next->pprev = tdata->pprev;
+	tdata->state &= ~WMSF_SWT_ACTIVE;
+}
+
+/* The timer expired: queue it for msf_timer_poll or add it to the list of
+ * timers whose handlers are called by wmsf_swt_call.
+ * Must be called with interrupts disabled. */
+static void wmsf_swt_fire(MSF_TIMER* tdata, MSF_TIMER** fired)
+{
+#if MSF_SWTIMER_DEFERRED
+	(void)fired;
+	if ( !(tdata->state & WMSF_SWT_PENDING) )
+	{
+		tdata->state |= WMSF_SWT_PENDING;
+		tdata->pending = null;
+		if ( gmsf_swt_pending_last != null )
+			gmsf_swt_pending_last->pending = tdata;
+		else
+			gmsf_swt_pending = tdata;
+		gmsf_swt_pending_last = tdata;
+	}
+	/* else the handler was not called since the previous expiration; the handler
+	 * will be called only once */
+#else
+	tdata->pending = *fired;
+	*fired = tdata;
+#endif
+}
+
+/* Call the handlers of the timers in the list made by wmsf_swt_fire */
+static void wmsf_swt_call(MSF_TIMER* fired)
+{
+	MSF_TIMER* t;
+
+	while ( fired != null )
+	{
+		t = fired;
+		fired = t->pending;
+		if ( (t->state & WMSF_SWT_ACTIVE) && t->handler != null )
+			t->handler();
+	}
+}
+
+/* Move the timers from the current slot of given level to the lower levels */
+static void wmsf_swt_cascade(uint8_t level)
+{
+	MSF_TIMER** slot = &gmsf_swt_wheel[level][(gmsf_swt_now >> (level * WMSF_SWT_BITS)) & WMSF_SWT_MASK];
+	MSF_TIMER* t = *slot;
+	MSF_TIMER* next;
+
+	*slot = null;
+	while ( t != null )
+	{
+		next = t->next;
+		wmsf_swt_insert(t);
+		t = next;
+	}
+}
+
+#endif	/* MSF_SWTIMER_API */
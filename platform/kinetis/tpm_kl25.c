@@ -50,6 +50,9 @@ static TPM_RESOURCES TPM0_Resources = {
   &TPM0_Info,
   &TPM0_Pins,
   6,	/* number of channels */
+  WMSF_TPM0_DMA_CHANNEL,
+  24,	/* DMAMUX source TPM0 channel 0 */
+  54,	/* DMAMUX source TPM0 overflow */
 };
 #endif /* MSF_DRIVER_TPM0 */
 
@@ -78,6 +81,9 @@ static TPM_RESOURCES TPM1_Resources = {
   &TPM1_Info,
   &TPM1_Pins,
   2,
+  WMSF_TPM1_DMA_CHANNEL,
+  32,	/* DMAMUX source TPM1 channel 0 */
+  55,	/* DMAMUX source TPM1 overflow */
 };
 #endif /* MSF_DRIVER_TPM1 */
 
@@ -105,9 +111,27 @@ static TPM_RESOURCES TPM2_Resources = {
   &TPM2_Info,
   &TPM2_Pins,
   2,
+  WMSF_TPM2_DMA_CHANNEL,
+  34,	/* DMAMUX source TPM2 channel 0 */
+  56,	/* DMAMUX source TPM2 overflow */
 };
 #endif /* MSF_DRIVER_TPM1 */
 
+#if MSF_TPM_DMA
+/* The TPM instance which uses given DMA channel; for the DMA interrupt handler */
+static TPM_RESOURCES* gtpm_dma_owner[4];
+
+/* The DMA byte counter is valid up to 20 bits */
+#define	WTPM_DMA_BCR_MAX	(0xFFFFFUL)
+/* The largest circular buffer of the DMA modulo addressing (DCR[SMOD] = 15) */
+#define	WTPM_DMA_SMOD_MAX	(256UL * 1024)
+
+/* Is the DMA channel n used by any of the TPM drivers? */
+#define	WTPM_USES_DMA(n)	((MSF_DRIVER_TPM0 && WMSF_TPM0_DMA_CHANNEL == n) || \
+							(MSF_DRIVER_TPM1 && WMSF_TPM1_DMA_CHANNEL == n) || \
+							(MSF_DRIVER_TPM2 && WMSF_TPM2_DMA_CHANNEL == n))
+#endif
+
 
 
 /* prototypes */
@@ -116,6 +140,15 @@ static uint32_t TPM_Control(uint32_t control, uint32_t arg, TPM_RESOURCES* tpm);
 /* internal functions */
 static void wtpm_enable_pin(uint32_t channel, TPM_RESOURCES* tpm);
 static void wtpm_enable_int(uint32_t irqno, uint32_t enable);    
+static void wtpm_select_clkin(TPM_RESOURCES* tpm);
+static uint32_t wtpm_gate_mask(TPM_RESOURCES* tpm);
+#if MSF_LOWPOWER
+static uint32_t wtpm_lp_client(TPM_RESOURCES* tpm);
+#endif
+#if MSF_TPM_DMA
+static void wtpm_stream_stop(TPM_RESOURCES* tpm);
+static void wtpm_dma_irq(uint32_t dma_channel);
+#endif
 
 /* The driver API functions */
 
@@ -135,6 +168,11 @@ static uint32_t  TPM_Initialize( MSF_TPM_Event_t event,  TPM_RESOURCES* tpm)
 	/* init given timer */	
 	tpm->info->cb_event = event;	/* store pointer to user callback*/
 	tpm->info->status = 0;	
+	for ( i=0; i<6; i++ )
+		tpm->info->ch_handler[i] = null;
+#if MSF_TPM_DMA
+	tpm->info->stream_table = null;
+#endif
 	
 	/* Set the clock for timers TPMx (shared by all instances) */
 	SIM->SOPT2 &= ~SIM_SOPT2_TPMSRC_MASK;	/* clear bits first, then set those needed */
@@ -154,8 +192,13 @@ static uint32_t  TPM_Initialize( MSF_TPM_Event_t event,  TPM_RESOURCES* tpm)
 	tpm->reg->CONF = 0;
 	
 	/* Now set internal clock (prescaler = 0) */
-	TPM_Control(MSF_TPM_CLOCK_INTERNAL, 0, tpm);
+	TPM_Control(MSF_TPM_CLOCK_INTERNAL | MSF_TPM_COUNTER_RESET, 0, tpm);
+	tpm->info->off_cmod = 0;
 
+#if MSF_LOWPOWER
+	/* full power; the timer does not run in the stop modes */
+	msf_lowpower_vote(wtpm_lp_client(tpm), msf_sleep_wait);
+#endif
     return MSF_ERROR_OK;
 }
 
@@ -198,6 +241,11 @@ static uint32_t  TPM_Uninitialize( TPM_RESOURCES* tpm)
 	uint32_t irq;
     /* Reset internal state for this instance of the TPM driver */
     tpm->info->cb_event = null;    
+    for ( irq=0; irq<6; irq++ )
+    	tpm->info->ch_handler[irq] = null;
+#if MSF_TPM_DMA
+    wtpm_stream_stop(tpm);
+#endif
     /* if interrupt is enabled in NVIC, disable it */
     if ( (tpm->info->status & (MSF_TPM_STATUS_ANY_CHANNEL | MSF_TPM_STATUS_SIGNAL_TOF)) != 0 )
     {
@@ -207,6 +255,11 @@ static uint32_t  TPM_Uninitialize( TPM_RESOURCES* tpm)
     
     tpm->info->status = 0;
         
+#if MSF_LOWPOWER
+    /* not used; does not limit the stop modes */
+    msf_lowpower_vote(wtpm_lp_client(tpm), msf_sleep_lls);
+    msf_lowpower_oscer(wtpm_lp_client(tpm), false);
+#endif
     return MSF_ERROR_OK;
 }
 
@@ -239,12 +292,65 @@ static uint32_t TPM2_Uninitialize (void)
   \brief       Change power mode for the timer
   \param[in]   state  The requested power state
   \param[in]   tpm The resources for the driver (driver instance)
-  \return      error code (0 = OK)
-  \note        Currently does nothing!               
+  \return      error code (0 = OK); MSF_ERROR_NOTSUPPORTED for msf_power_low if the timer 
+  	  	  	  is not clocked from the crystal (see MSF_TPM_CLKSEL in msf_<device>.h).
+  \note        
+  	  msf_power_off: the counter is stopped and the clock of the timer is disabled. 
+  	  	  Do not call other functions of the driver until the power is set to full again. 
+  	  msf_power_low: the timer runs also in VLPS stop mode (the crystal clock is kept running
+  	  	  in the stop modes), so its interrupts (overflow, channels) wake up the CPU.
+  	  msf_power_full: normal operation; the counter continues if it was stopped by msf_power_off.               
 */
 static uint32_t TPM_PowerControl(MSF_power_state state, TPM_RESOURCES* tpm)
 {
-    return MSF_ERROR_NOTSUPPORTED;
+	uint32_t gate = wtpm_gate_mask(tpm);
+	
+	switch ( state )
+	{
+	case msf_power_off:
+		if ( (SIM->SCGC6 & gate) == 0 )
+			return MSF_ERROR_OK;	/* already off */
+		/* stop the counter; the change of CMOD must be acknowledged before the clock is disabled */
+		tpm->info->off_cmod = tpm->reg->SC & TPM_SC_CMOD_MASK;
+		tpm->reg->SC &= ~TPM_SC_CMOD_MASK;
+		while (tpm->reg->SC & TPM_SC_CMOD_MASK ) ;
+		SIM->SCGC6 &= ~gate;
+#if MSF_LOWPOWER
+		msf_lowpower_vote(wtpm_lp_client(tpm), msf_sleep_lls);
+		msf_lowpower_oscer(wtpm_lp_client(tpm), false);
+#endif
+		break;
+	
+	case msf_power_low:
+	case msf_power_full:
+#if MSF_TPM_CLKSEL != 2
+		/* the timer clock stops in the stop modes */
+		if ( state == msf_power_low )
+			return MSF_ERROR_NOTSUPPORTED;
+#endif
+		if ( (SIM->SCGC6 & gate) == 0 )
+		{
+			/* restart the counter stopped by msf_power_off */
+			SIM->SCGC6 |= gate;
+			tpm->reg->SC |= tpm->info->off_cmod;
+			tpm->info->off_cmod = 0;
+		}
+#if MSF_LOWPOWER
+		msf_lowpower_vote(wtpm_lp_client(tpm), 
+				(state == msf_power_low) ? msf_sleep_vlps : msf_sleep_wait);
+		/* OSCERCLK runs in the stop modes while some timer is in msf_power_low */
+		msf_lowpower_oscer(wtpm_lp_client(tpm), state == msf_power_low);
+#else
+		if ( state == msf_power_low )
+			OSC0->CR |= OSC_CR_EREFSTEN_MASK;	/* OSCERCLK runs in the stop modes */
+#endif
+		break;
+		
+	default:
+		return MSF_ERROR_ARGUMENT;
+	}
+	
+    return MSF_ERROR_OK;
 } 
 
 #if (MSF_DRIVER_TPM0)    
@@ -284,7 +390,10 @@ static uint32_t TPM_Control(uint32_t control, uint32_t arg, TPM_RESOURCES* tpm)
 {	
 	uint32_t val, i;
 	
-	tpm->reg->CNT = 0;	/* reset counter */
+	/* Note: the counter is reset only on request, so that the channels which are running 
+	 * are not disturbed when other options are changed. */
+	if ( control & MSF_TPM_CNT_RESET_Mask )
+		tpm->reg->CNT = 0;	/* any write resets the counter */
 	
 	/* Changing clock option: disabled/internal/external */
 	if ( control & MSF_TPM_CLOCK_MODE_Mask )
@@ -293,6 +402,8 @@ static uint32_t TPM_Control(uint32_t control, uint32_t arg, TPM_RESOURCES* tpm)
 		tpm->reg->SC &= ~TPM_SC_CMOD_MASK;
 		/* wait until the counter is really disabled (change is "acknowledged in the timer clock domain" :) )*/
 		while (tpm->reg->SC & TPM_SC_CMOD_MASK ) ;
+		if ( (control & MSF_TPM_CLOCK_MODE_Mask) == MSF_TPM_CLOCK_EXTERNAL )
+			wtpm_select_clkin(tpm);
 		tpm->reg->SC |= TPM_SC_CMOD(val-1);				
 	}
 	
@@ -366,6 +477,20 @@ static uint32_t TPM_Control(uint32_t control, uint32_t arg, TPM_RESOURCES* tpm)
 		tpm->reg->SC |= val;	
 	}
 	
+	/* Global time base; CONF can be written only with the counter disabled */
+	if ( control & MSF_TPM_GTB_Mask )
+	{
+		val = (tpm->reg->SC & TPM_SC_CMOD_MASK);
+		tpm->reg->SC &= ~TPM_SC_CMOD_MASK;
+		while (tpm->reg->SC & TPM_SC_CMOD_MASK ) ;
+		
+		if ( (control & MSF_TPM_GTB_Mask) == MSF_TPM_GTB_ENABLE )
+			tpm->reg->CONF |= TPM_CONF_GTBEEN_MASK;
+		else
+			tpm->reg->CONF &= ~TPM_CONF_GTBEEN_MASK;
+		
+		tpm->reg->SC |= val;
+	}
 	
     return MSF_ERROR_OK;
 }
@@ -438,8 +563,6 @@ static uint32_t TPM_ChannelSetMode(uint32_t channel, TMP_channel_mode_t mode, ui
 	/* wait until the counter is really disabled (change is "acknowledged in the timer clock domain" :) )*/
 	while (tpm->reg->SC & TPM_SC_CMOD_MASK ) ;
 	
-	tpm->reg->CNT = 0;	/* reset counter */
-	
 	/* disable the channel which will be changed*/
 	tpm->reg->CONTROLS[channel].CnSC = 0;
 	while ( tpm->reg->CONTROLS[channel].CnSC != 0 )
@@ -656,30 +779,278 @@ static uint32_t TPM2_ChannelRead(uint32_t channel)
 }
 #endif   /* MSF_DRIVER_TPM2 */
 
+/**
+  \brief       Set direct handler for the channel event
+  \param[in]   channel The number of the channel (0-5) but depends on TPMn module!
+  \param[in]   handler The function to call for the channel event or null to 
+  	  	  	  	report the event through the callback given in Initialize. 
+  \param[in]   tpm The resources for the driver (driver instance) 
+  \return      error code (0 = OK)
+  \note       The handler is called only if the event for the channel is enabled 
+  	  	  	  by ChannelSetMode with MSF_TPM_PARAM_CHANNEL_EVENT. 
+  	  	  	  It saves the decoding of the event mask in the user callback, which 
+  	  	  	  matters if the channel events come at high rate.                    
+*/
+static uint32_t TPM_ChannelSetHandler(uint32_t channel, MSF_TPM_Channel_Event_t handler, TPM_RESOURCES* tpm) 
+{
+	if ( channel >= tpm->nchannels )
+		return MSF_ERROR_ARGUMENT;
+	tpm->info->ch_handler[channel] = handler;
+	return MSF_ERROR_OK;
+}
 
-/** Interrupt handler for all TMPn instances */
-void TPM_IRQHandler(TPM_RESOURCES* tpm)
+#if (MSF_DRIVER_TPM0)   
+static uint32_t TPM0_ChannelSetHandler(uint32_t channel, MSF_TPM_Channel_Event_t handler) 
 {
-	uint32_t i;
+	return TPM_ChannelSetHandler(channel, handler, &TPM0_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM0 */
+
+#if (MSF_DRIVER_TPM1)   
+static uint32_t TPM1_ChannelSetHandler(uint32_t channel, MSF_TPM_Channel_Event_t handler) 
+{
+	return TPM_ChannelSetHandler(channel, handler, &TPM1_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM1 */
+
+#if (MSF_DRIVER_TPM2)   
+static uint32_t TPM2_ChannelSetHandler(uint32_t channel, MSF_TPM_Channel_Event_t handler) 
+{
+	return TPM_ChannelSetHandler(channel, handler, &TPM2_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM2 */
+
+/**
+  \brief       Get the direct handler for the channel event
+  \param[in]   channel The number of the channel (0-5) but depends on TPMn module!
+  \param[in]   tpm The resources for the driver (driver instance) 
+  \return      the handler set by ChannelSetHandler; null if there is none
+  	  	  	  or the channel is not valid.
+  \note       Allows a module to install its handler temporarily and restore 
+  	  	  	  the previous one afterwards.                    
+*/
+static MSF_TPM_Channel_Event_t TPM_ChannelGetHandler(uint32_t channel, TPM_RESOURCES* tpm) 
+{
+	if ( channel >= tpm->nchannels )
+		return null;
+	return tpm->info->ch_handler[channel];
+}
+
+#if (MSF_DRIVER_TPM0)   
+static MSF_TPM_Channel_Event_t TPM0_ChannelGetHandler(uint32_t channel) 
+{
+	return TPM_ChannelGetHandler(channel, &TPM0_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM0 */
+
+#if (MSF_DRIVER_TPM1)   
+static MSF_TPM_Channel_Event_t TPM1_ChannelGetHandler(uint32_t channel) 
+{
+	return TPM_ChannelGetHandler(channel, &TPM1_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM1 */
+
+#if (MSF_DRIVER_TPM2)   
+static MSF_TPM_Channel_Event_t TPM2_ChannelGetHandler(uint32_t channel) 
+{
+	return TPM_ChannelGetHandler(channel, &TPM2_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM2 */
+
+/**
+  \brief       Stream table of values into the channel register (CnV) using DMA
+  \param[in]   channel The number of the channel (0-5) but depends on TPMn module!
+  \param[in]   table The values to write into CnV. Must exist while the stream is running.
+  	  	  	  	If null (or count is 0) the stream in progress is stopped. 
+  \param[in]   count Number of values in the table; max. MSF_TPM_STREAM_MAX_COUNT.
+  \param[in]   flags MSF_TPM_STREAM_ON_CHANNEL or MSF_TPM_STREAM_ON_OVERFLOW, optionally
+  	  	  	  	ORed with MSF_TPM_STREAM_CIRCULAR. 
+  \param[in]   tpm The resources for the driver (driver instance) 
+  \return      error code (0 = OK); MSF_ERROR_NOTSUPPORTED if MSF_TPM_DMA is not enabled.
+  \note       Set the channel mode with ChannelSetMode and the first value with ChannelWrite
+  	  	  	  before calling this; ChannelSetMode stops the stream.
+  	  	  	  One value is written on each request of the timer: 
+  	  	  	  ON_CHANNEL - on channel match, e.g. next compare time in OutCompare_toggle mode 
+  	  	  	  (pulse train). The values are absolute counter values, not the intervals.
+  	  	  	  ON_OVERFLOW - on counter overflow, e.g. next duty in PWM mode (waveform).
+  	  	  	  While streaming on overflow, the TOF event is not reported.
+  	  	  	  MSF_TPM_EVENT_STREAM_END is signaled at the end of the table. 
+  	  	  	  In circular mode the DMA wraps around the table by itself (modulo addressing),
+  	  	  	  so the table must meet the constraints given in tpm_kl25.h, otherwise 
+  	  	  	  MSF_ERROR_ARGUMENT is returned. The byte counter is set to the largest multiple
+  	  	  	  of the table which fits in it; the DMA interrupt only sets it again, once per
+  	  	  	  about 1 MB transferred, and signals MSF_TPM_EVENT_STREAM_END then.
+  	  	  	  Only one stream per TPM instance can run at a time.  
+*/
+static uint32_t TPM_ChannelStream(uint32_t channel, const uint16_t* table, uint32_t count, uint32_t flags, TPM_RESOURCES* tpm) 
+{
+#if MSF_TPM_DMA
+	uint32_t dch = tpm->dma_channel;
+	uint32_t source, bytes, smod;
 	
-	if ( tpm->reg->SC & TPM_SC_TOF_MASK)
+	if ( channel >= tpm->nchannels || count > MSF_TPM_STREAM_MAX_COUNT )
+		return MSF_ERROR_ARGUMENT;
+	
+	wtpm_stream_stop(tpm);
+	if ( table == null || count == 0 )
+		return MSF_ERROR_OK;
+	
+	bytes = count * 2;
+	smod = 0;
+	if ( flags & MSF_TPM_STREAM_CIRCULAR )
 	{
-		tpm->reg->SC |= TPM_SC_TOF_MASK;	/* clear TOF flag */
-		if ( tpm->info->cb_event && (tpm->info->status & MSF_TPM_STATUS_SIGNAL_TOF) )
-			tpm->info->cb_event(MSF_TPM_EVENT_TOF, 0);
+		/* The modulo addressing keeps the upper bits of the address, so the table 
+		 * must be a power of 2 in size (16 B thru 256 KB) and aligned to its size */
+		if ( bytes < 16 || bytes > WTPM_DMA_SMOD_MAX || (bytes & (bytes - 1)) != 0 
+				|| ((uint32_t)table & (bytes - 1)) != 0 )
+			return MSF_ERROR_ARGUMENT;
+		for ( smod = 1; (16UL << (smod - 1)) < bytes; smod++ )
+			;
+		/* play the table as many times as the byte counter allows */
+		bytes = (WTPM_DMA_BCR_MAX / bytes) * bytes;
 	}
 	
-	/* should we report any channel interrupt? */
-	if ( tpm->info->status & MSF_TPM_STATUS_ANY_CHANNEL )
+	SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+	SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+	
+	tpm->info->stream_table = table;
+	tpm->info->stream_bytes = bytes;
+	tpm->info->stream_channel = (uint8_t)channel;
+	tpm->info->stream_flags = (uint8_t)flags;
+	gtpm_dma_owner[dch] = tpm;
+	
+	/* 16-bit transfers from the table to CnV, one transfer per request.
+	 * One-shot: the request is disabled at the end of the table (D_REQ). 
+	 * Circular: the source address wraps around the table (SMOD) and the request 
+	 * stays enabled; the interrupt only sets the byte counter again. */
+	DMA0->DMA[dch].DSR_BCR = DMA_DSR_BCR_DONE_MASK;	/* clear status flags */
+	DMA0->DMA[dch].SAR = (uint32_t)table;
+	DMA0->DMA[dch].DAR = (uint32_t)&tpm->reg->CONTROLS[channel].CnV;
+	DMA0->DMA[dch].DSR_BCR = DMA_DSR_BCR_BCR(bytes);
+	DMA0->DMA[dch].DCR = DMA_DCR_EINT_MASK | DMA_DCR_ERQ_MASK | DMA_DCR_CS_MASK | DMA_DCR_SINC_MASK 
+			| DMA_DCR_SSIZE(2) | DMA_DCR_DSIZE(2) 
+			| ((smod != 0) ? DMA_DCR_SMOD(smod) : DMA_DCR_D_REQ_MASK);
+	
+	source = (flags & MSF_TPM_STREAM_ON_OVERFLOW) ? tpm->dma_source_tof : (tpm->dma_source_ch0 + channel);
+	DMAMUX0->CHCFG[dch] = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(source);
+	wtpm_enable_int(DMA0_IRQn + dch, 1);
+	
+	/* Let the timer request the transfers; with DMA bit set the flag generates
+	 * DMA request instead of the interrupt */
+	if ( flags & MSF_TPM_STREAM_ON_OVERFLOW )
+		tpm->reg->SC |= (TPM_SC_DMA_MASK | TPM_SC_TOIE_MASK);
+	else
+		tpm->reg->CONTROLS[channel].CnSC |= (TPM_CnSC_DMA_MASK | TPM_CnSC_CHIE_MASK);
+	
+	return MSF_ERROR_OK;
+#else
+	return MSF_ERROR_NOTSUPPORTED;
+#endif
+}
+
+#if (MSF_DRIVER_TPM0)   
+static uint32_t TPM0_ChannelStream(uint32_t channel, const uint16_t* table, uint32_t count, uint32_t flags) 
+{
+	return TPM_ChannelStream(channel, table, count, flags, &TPM0_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM0 */
+
+#if (MSF_DRIVER_TPM1)   
+static uint32_t TPM1_ChannelStream(uint32_t channel, const uint16_t* table, uint32_t count, uint32_t flags) 
+{
+	return TPM_ChannelStream(channel, table, count, flags, &TPM1_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM1 */
+
+#if (MSF_DRIVER_TPM2)   
+static uint32_t TPM2_ChannelStream(uint32_t channel, const uint16_t* table, uint32_t count, uint32_t flags) 
+{
+	return TPM_ChannelStream(channel, table, count, flags, &TPM2_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM2 */
+
+
+/**
+  \brief       Read the counter of the timer
+  \param[in]   tpm The resources for the driver (driver instance) 
+  \return      The counter value (CNT) in bits 0 - 15 and MSF_TPM_COUNTER_TOF bit set if the 
+  	  	  	  counter overflow is pending (not yet handled by the interrupt handler).
+  \note       The counter and the flag are read so that they belong together: if the flag is set, 
+  	  	  	  the overflow occurred before the counter value was read. 
+  	  	  	  This allows extending the counter by counting the overflows in the TOF event.                     
+*/
+static uint32_t TPM_CounterRead(TPM_RESOURCES* tpm) 
+{
+	uint32_t tof, cnt;
+	
+	do
+	{
+		tof = tpm->reg->STATUS & TPM_STATUS_TOF_MASK;
+		cnt = tpm->reg->CNT;
+	} while ( tof != (tpm->reg->STATUS & TPM_STATUS_TOF_MASK) );
+	
+	return (tof) ? (cnt | MSF_TPM_COUNTER_TOF) : cnt;
+}
+
+#if (MSF_DRIVER_TPM0)   
+static uint32_t TPM0_CounterRead(void) 
+{
+	return TPM_CounterRead(&TPM0_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM0 */
+
+#if (MSF_DRIVER_TPM1)   
+static uint32_t TPM1_CounterRead(void) 
+{
+	return TPM_CounterRead(&TPM1_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM1 */
+
+#if (MSF_DRIVER_TPM2)   
+static uint32_t TPM2_CounterRead(void) 
+{
+	return TPM_CounterRead(&TPM2_Resources); 
+}
+#endif   /* MSF_DRIVER_TPM2 */
+
+
+/** Interrupt handler for all TMPn instances 
+ * The flags of all channels and TOF are read from the STATUS register at once
+ * and cleared with single write. Only the channels with enabled event are 
+ * serviced (cleared); the flags of the other channels are left for the user 
+ * to poll. The flags which request the DMA transfers of a stream are left 
+ * for the DMA, which clears them. */
+void TPM_IRQHandler(TPM_RESOURCES* tpm)
+{
+	uint32_t flags, i;
+	TPM_INFO* info = tpm->info;
+	
+	/* The STATUS register has CHnF in bit n and TOF in bit 8; the channel 
+	 * events in info->status are shifted by 1 (bit 0 is TOF event). */
+	flags = TPM_STATUS_TOF_MASK | ((info->status & MSF_TPM_STATUS_ANY_CHANNEL) >> 1);
+#if MSF_TPM_DMA
+	if ( tpm->reg->SC & TPM_SC_DMA_MASK )
+		flags &= ~TPM_STATUS_TOF_MASK;
+	if ( info->stream_table != null && (info->stream_flags & MSF_TPM_STREAM_ON_OVERFLOW) == 0 )
+		flags &= ~(1UL << info->stream_channel);
+#endif
+	flags &= tpm->reg->STATUS;
+	tpm->reg->STATUS = flags;	/* clear the flags (write 1 to clear) */
+	
+	if ( (flags & TPM_STATUS_TOF_MASK) && info->cb_event && (info->status & MSF_TPM_STATUS_SIGNAL_TOF) )
+		info->cb_event(MSF_TPM_EVENT_TOF, 0);
+	
+	/* Walk the channel flags; the loop ends after the highest flag which is set */
+	flags &= ~TPM_STATUS_TOF_MASK;
+	for ( i=0; flags != 0; i++, flags >>= 1 )
 	{
-		for ( i=0; i<tpm->nchannels; i++)
+		if ( flags & 1 )
 		{
-			if (tpm->reg->CONTROLS[i].CnSC & TPM_CnSC_CHF_MASK)
-			{
-				tpm->reg->CONTROLS[i].CnSC |= TPM_CnSC_CHF_MASK;	/* clear the interrupt flag */
-				/* call user handler with the channel value in arg parameter */
-				tpm->info->cb_event(MSF_TPM_EVENT_CHN(i), tpm->reg->CONTROLS[i].CnV);				
-			}
+			/* call the handler with the channel value in arg parameter */
+			if ( info->ch_handler[i] )
+				info->ch_handler[i](i, tpm->reg->CONTROLS[i].CnV);
+			else if ( info->cb_event )
+				info->cb_event(MSF_TPM_EVENT_CHN(i), tpm->reg->CONTROLS[i].CnV);				
 		}
 	}
 }
@@ -707,6 +1078,34 @@ void TPM2_IRQHandler(void)
 }
 #endif /* MSF_DRIVER_TPM2 */
 
+/* Interrupt handlers for the DMA channels used by the TPM drivers */
+#if MSF_TPM_DMA
+#if WTPM_USES_DMA(0)
+void DMA0_IRQHandler(void)
+{
+	wtpm_dma_irq(0);
+}
+#endif
+#if WTPM_USES_DMA(1)
+void DMA1_IRQHandler(void)
+{
+	wtpm_dma_irq(1);
+}
+#endif
+#if WTPM_USES_DMA(2)
+void DMA2_IRQHandler(void)
+{
+	wtpm_dma_irq(2);
+}
+#endif
+#if WTPM_USES_DMA(3)
+void DMA3_IRQHandler(void)
+{
+	wtpm_dma_irq(3);
+}
+#endif
+#endif /* MSF_TPM_DMA */
+
 /* Access structure for TPM0 */
 #if (MSF_DRIVER_TPM0)
 /* Only if the user-configuration in msf_config_<device>.h specifies that
@@ -719,7 +1118,10 @@ MSF_DRIVER_TPM Driver_TPM0 = {
   TPM0_ChannelSetMode,
   TPM0_ChannelWrite,
   TPM0_ChannelRead,
-  
+  TPM0_ChannelSetHandler,
+  TPM0_ChannelGetHandler,
+  TPM0_ChannelStream,
+  TPM0_CounterRead,
 };
 #endif	/* MSF_DRIVER_TPM0 */
 
@@ -735,7 +1137,10 @@ MSF_DRIVER_TPM Driver_TPM1 = {
   TPM1_ChannelSetMode,
   TPM1_ChannelWrite,
   TPM1_ChannelRead,
-  
+  TPM1_ChannelSetHandler,
+  TPM1_ChannelGetHandler,
+  TPM1_ChannelStream,
+  TPM1_CounterRead,
 };
 #endif	/* MSF_DRIVER_TPM1 */
 
@@ -751,6 +1156,10 @@ MSF_DRIVER_TPM Driver_TPM2 = {
   TPM2_ChannelSetMode,
   TPM2_ChannelWrite,
   TPM2_ChannelRead,  
+  TPM2_ChannelSetHandler,
+  TPM2_ChannelGetHandler,
+  TPM2_ChannelStream,
+  TPM2_CounterRead,
 };
 #endif	/* MSF_DRIVER_TPM2 */
 
@@ -783,5 +1192,101 @@ static void wtpm_enable_int(uint32_t irqno, uint32_t enable)
 		NVIC_DisableIRQ(irqno);	
 	}
 }
+
+/* Get the mask of the clock gate bit in SIM_SCGC6 for the timer */
+static uint32_t wtpm_gate_mask(TPM_RESOURCES* tpm)
+{
+	if ( tpm->reg == TPM0 )
+		return SIM_SCGC6_TPM0_MASK;
+	return (tpm->reg == TPM1) ? SIM_SCGC6_TPM1_MASK : SIM_SCGC6_TPM2_MASK;
+}
+
+#if MSF_LOWPOWER
+/* Get the client of the low-power manager for the timer */
+static uint32_t wtpm_lp_client(TPM_RESOURCES* tpm)
+{
+	if ( tpm->reg == TPM0 )
+		return MSF_LP_TPM0;
+	return (tpm->reg == TPM1) ? MSF_LP_TPM1 : MSF_LP_TPM2;
+}
+#endif
+
+/* Select the TPM_CLKINx input as the external clock of the timer and configure its pin */
+static void wtpm_select_clkin(TPM_RESOURCES* tpm)
+{
+	uint32_t mask = ((TPM_Type*)tpm->reg == TPM0) ? SIM_SOPT4_TPM0CLKSEL_MASK :
+					((TPM_Type*)tpm->reg == TPM1) ? SIM_SOPT4_TPM1CLKSEL_MASK : SIM_SOPT4_TPM2CLKSEL_MASK;
+#if WMSF_TPM_CLKIN
+	SIM->SOPT4 |= mask;
+#else
+	SIM->SOPT4 &= ~mask;
+#endif
+
+#ifdef MSF_TPM_CLKIN_PIN
+	GPIO_PORT_OBJECT(MSF_TPM_CLKIN_PIN)->PCR[GPIO_PIN_NUM(MSF_TPM_CLKIN_PIN)] = PORT_PCR_MUX(MSF_TPM_CLKIN_ALT);
+#endif
+}
+
+#if MSF_TPM_DMA
+/* Stop the DMA stream of given TPM instance, if there is any */
+static void wtpm_stream_stop(TPM_RESOURCES* tpm)
+{
+	uint32_t dch = tpm->dma_channel;
+	uint32_t channel = tpm->info->stream_channel;
+	
+	if ( tpm->info->stream_table == null )
+		return;
+	
+	/* stop the requests from the timer */
+	if ( tpm->info->stream_flags & MSF_TPM_STREAM_ON_OVERFLOW )
+	{
+		tpm->reg->SC &= ~TPM_SC_DMA_MASK;
+		if ( (tpm->info->status & MSF_TPM_STATUS_SIGNAL_TOF) == 0 )
+			tpm->reg->SC &= ~TPM_SC_TOIE_MASK;
+	}
+	else
+	{
+		tpm->reg->CONTROLS[channel].CnSC &= ~TPM_CnSC_DMA_MASK;
+		if ( (tpm->info->status & MSF_TPM_STATUS_SIGNAL_CHN(channel)) == 0 )
+			tpm->reg->CONTROLS[channel].CnSC &= ~TPM_CnSC_CHIE_MASK;
+	}
+	
+	wtpm_enable_int(DMA0_IRQn + dch, 0);
+	DMAMUX0->CHCFG[dch] = 0;
+	DMA0->DMA[dch].DCR = 0;
+	DMA0->DMA[dch].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	
+	gtpm_dma_owner[dch] = null;
+	tpm->info->stream_table = null;
+}
+
+/* Common DMA interrupt handler; called when the byte counter reaches 0 (or on error):
+ * at the end of the table or, in circular mode, after the last of the passes of the
+ * table set in the counter */
+static void wtpm_dma_irq(uint32_t dma_channel)
+{
+	TPM_RESOURCES* tpm = gtpm_dma_owner[dma_channel];
+	uint32_t channel;
+	
+	DMA0->DMA[dma_channel].DSR_BCR = DMA_DSR_BCR_DONE_MASK;	/* clear the flags */
+	if ( tpm == null )
+		return;
+	
+	channel = tpm->info->stream_channel;
+	if ( tpm->info->stream_flags & MSF_TPM_STREAM_CIRCULAR )
+	{
+		/* the source address is at the beginning of the table again (modulo 
+		 * addressing) and the request is still enabled; just set the counter */
+		DMA0->DMA[dma_channel].DSR_BCR = DMA_DSR_BCR_BCR(tpm->info->stream_bytes);
+	}
+	else
+	{
+		wtpm_stream_stop(tpm);
+	}
+	
+	if ( tpm->info->cb_event )
+		tpm->info->cb_event(MSF_TPM_EVENT_STREAM_END, channel);
+}
+#endif /* MSF_TPM_DMA */
 /**@}*/
 /* ----------- end of file -------------- */
@@ -27,10 +27,27 @@ extern "C" {
  * @{ 
 */ 
 
+/* Circular streams (ChannelStream with MSF_TPM_STREAM_CIRCULAR)
+ * The DMA wraps around the table using its modulo addressing (DCR[SMOD]), so the 
+ * table must be:
+ * - a power of 2 in size, 16 bytes thru 256 KB, i.e. 8 thru 131072 values;
+ * - aligned to its size in memory, e.g. __attribute__((aligned(64))) for 32 values.
+ * The end event is signaled once per the number of passes of the table which fit 
+ * into the 20-bit DMA byte counter (e.g. every 32768 passes of a 32-byte table). 
+ * The DMA interrupt must then set the counter again before the next request. */
+
 /* TPM Run-time information*/
 typedef struct _TPM_INFO {
   MSF_TPM_Event_t cb_event;          // Event Callback
   uint32_t      status;               // Status flags 
+  MSF_TPM_Channel_Event_t ch_handler[6];	// Optional direct handlers for the channels
+  uint32_t		off_cmod;			// The counter clock mode (SC[CMOD]) saved while the power is off
+#if MSF_TPM_DMA
+  const uint16_t* stream_table;		// Table streamed by DMA into the channel; null if not streaming 
+  uint32_t		stream_bytes;		// Bytes per DMA run: the table; in circular mode a multiple of it
+  uint8_t		stream_channel;		// The channel which receives the values 
+  uint8_t		stream_flags;		// MSF_TPM_STREAM_xxx flags
+#endif
        
 } TPM_INFO;
 
@@ -60,6 +77,9 @@ typedef struct {
         TPM_INFO	*info;   	/* Run-Time information */
         TPM_PINS	*pins;		/* Pins used for our channels*/
         uint8_t		nchannels;	/* number of channels available in this module */
+        uint8_t		dma_channel;	/* DMA channel used for ChannelStream */
+        uint8_t		dma_source_ch0;	/* DMAMUX request source for channel 0; channel n is +n */
+        uint8_t		dma_source_tof;	/* DMAMUX request source for the counter overflow */
 } const TPM_RESOURCES;
 
 
@@ -33,6 +33,10 @@
 
 #include "uart_kl25.h"
 
+#if MSF_CLOCK_SWITCH
+/* The bus clock for which the UART1/2 values in the baudrate enum are computed (F_CPU 48 MHz) */
+#define	UART_BUS_CLOCK_NOMINAL	(24000000u)
+#endif
 
 #if (MSF_DRIVER_UART0)
 /* Define the resource for each UART available on the MCU */
@@ -115,6 +119,14 @@ static void uart0_setbaudrate(uint32_t baudrate, UART_RESOURCES* uart);
 static void uart0_intconfig(uint32_t enable, UART_RESOURCES* uart);
 static uint32_t uart1_setbaudrate(uint32_t baudrate, UART_RESOURCES* uart);
 static void uart1_intconfig(uint32_t enable, UART_RESOURCES* uart);
+static uint32_t uart_gate_mask(UART_RESOURCES* uart);
+#if MSF_LOWPOWER
+static uint32_t uart_lp_client(UART_RESOURCES* uart);
+#endif
+#if MSF_CLOCK_SWITCH
+static uint8_t uart1_clock_changed(uint32_t bus_clock, bool check);
+static uint32_t uart1_scale_br(uint32_t baudrate, uint32_t bus_clock);
+#endif
 
 /* The driver API functions */
 
@@ -188,10 +200,18 @@ static uint32_t  UART_Initialize( UART_speed_t baudrate, MSF_UART_Event_t event,
 				
 		if ( !uart1_setbaudrate((uint32_t)baudrate, uart) )
 			return MSF_ERROR_ARGUMENT;		/* It will return zero if the baudrate is not supported */
+#if MSF_CLOCK_SWITCH
+		/* the bus clock can change; set the baudrate again then */
+		msf_clock_notify_add(uart1_clock_changed);
+#endif
 		
 		/* Enable receiver and transmitter */
 		uart->reg1->C2 |= (UART_C2_TE_MASK | UART_C2_RE_MASK );
 	}
+#if MSF_LOWPOWER
+	/* full power; the UART needs the bus clock */
+	msf_lowpower_vote(uart_lp_client(uart), msf_sleep_wait);
+#endif
     return MSF_ERROR_OK;
 }
 
@@ -229,6 +249,7 @@ static uint32_t  UART_Uninitialize( UART_RESOURCES* uart)
     /* Reset internal state for this instance of the UART driver */
     uart->info->cb_event = null;
     uart->info->status = 0;
+    uart->info->baudrate = 0;
     
     /* Disable the UART */
     if (uart->reg )
@@ -236,6 +257,11 @@ static uint32_t  UART_Uninitialize( UART_RESOURCES* uart)
     else
     	uart->reg1->C2 &= ~(UART_C2_TE_MASK | UART_C2_RE_MASK);
     
+#if MSF_LOWPOWER
+    /* not used; does not limit the stop modes */
+    msf_lowpower_vote(uart_lp_client(uart), msf_sleep_lls);
+    msf_lowpower_oscer(uart_lp_client(uart), false);
+#endif
     return MSF_ERROR_OK;
 }
 /* Instance specific function pointed-to from the driver access struct */
@@ -258,13 +284,99 @@ static uint32_t UART2_Uninitialize (void)
   \brief       Change the power mode of the UART.
   \param[in]   state  The requested power state
   \param[in]   uart    Pointer to UART resources
-  \return      error code (0 = OK)
+  \return      error code (0 = OK); MSF_ERROR_NOTSUPPORTED for msf_power_low if the UART0 
+  	  	  	  is not clocked from the crystal (see MSF_UART0_CLKSEL in msf_<device>.h).
   \note        Common function called by instance-specific function.
-                Currently does nothing!
+  	  msf_power_off: the transfer in progress is stopped and the clock of the UART is disabled.
+  	  	  Do not call other functions of the driver until the power is set to full again.  
+  	  msf_power_low: the UART works and the Rx active edge interrupt is enabled, so that
+  	  	  the character coming to the Rx pin wakes up the CPU from VLPS stop mode. 
+  	  	  The UART0 clocked from the crystal (OSCERCLK) receives the data also in VLPS. 
+  	  	  The UART1/2 stop in VLPS with the bus clock, so the first character is lost.
+  	  msf_power_full: normal operation; a transfer interrupted by msf_power_off must be started again.
 */
 static uint32_t UART_PowerControl(MSF_power_state state, UART_RESOURCES* uart)
 {
-    return MSF_ERROR_NOTSUPPORTED;
+	uint32_t gate = uart_gate_mask(uart);
+	
+	if ( state == msf_power_off )
+	{
+		/* stop any transfer in progress and disable the UART */
+		uart->info->status &= ~(MSF_UART_STATUS_TXNOW | MSF_UART_STATUS_RXNOW);
+		if ( uart->reg )
+		{
+			uart->reg->C2 = 0;
+			uart->reg->BDH &= ~UART0_BDH_RXEDGIE_MASK;
+		}
+		else
+		{
+			uart->reg1->C2 = 0;
+			uart->reg1->BDH &= ~UART_BDH_RXEDGIE_MASK;
+		}
+		SIM->SCGC4 &= ~gate;
+#if MSF_LOWPOWER
+		msf_lowpower_vote(uart_lp_client(uart), msf_sleep_lls);
+		msf_lowpower_oscer(uart_lp_client(uart), false);
+#endif
+		return MSF_ERROR_OK;
+	}
+	
+	if ( state != msf_power_low && state != msf_power_full )
+		return MSF_ERROR_ARGUMENT;
+#if MSF_UART0_CLKSEL != 2
+	/* the UART0 clock stops in the stop modes */
+	if ( state == msf_power_low && uart->reg )
+		return MSF_ERROR_NOTSUPPORTED;
+#endif
+	
+	SIM->SCGC4 |= gate;
+	if ( uart->reg )
+	{
+		if ( state == msf_power_low )
+		{
+#if !MSF_LOWPOWER
+			/* OSCERCLK runs in the stop modes; with the low-power manager it is requested below */
+			OSC0->CR |= OSC_CR_EREFSTEN_MASK;
+#endif
+			uart->reg->S2 = (uart->reg->S2 & ~UART0_S2_LBKDIF_MASK) | UART0_S2_RXEDGIF_MASK;
+			uart->reg->BDH |= UART0_BDH_RXEDGIE_MASK;
+			NVIC_EnableIRQ(UART0_IRQn);
+		}
+		else
+		{
+			uart->reg->BDH &= ~UART0_BDH_RXEDGIE_MASK;
+			if ( (uart->info->status & MSF_UART_STATUS_INT_MODE) == 0 )
+				NVIC_DisableIRQ(UART0_IRQn);
+		}
+		uart->reg->C2 |= (UART0_C2_TE_MASK | UART0_C2_RE_MASK);
+	}
+	else
+	{
+		if ( state == msf_power_low )
+		{
+			uart->reg1->S2 = (uart->reg1->S2 & ~UART_S2_LBKDIF_MASK) | UART_S2_RXEDGIF_MASK;
+			uart->reg1->BDH |= UART_BDH_RXEDGIE_MASK;
+			NVIC_EnableIRQ(MSF_UART_GETNVIC_IRQn(uart->reg1));
+		}
+		else
+		{
+			uart->reg1->BDH &= ~UART_BDH_RXEDGIE_MASK;
+			if ( (uart->info->status & MSF_UART_STATUS_INT_MODE) == 0 )
+				NVIC_DisableIRQ(MSF_UART_GETNVIC_IRQn(uart->reg1));
+		}
+#if MSF_CLOCK_SWITCH
+		/* the bus clock could change while the UART clock was disabled */
+		uart1_setbaudrate(uart->info->baudrate, uart);
+#endif
+		uart->reg1->C2 |= (UART_C2_TE_MASK | UART_C2_RE_MASK);
+	}
+#if MSF_LOWPOWER
+	msf_lowpower_vote(uart_lp_client(uart), 
+			(state == msf_power_low) ? msf_sleep_vlps : msf_sleep_wait);
+	/* the UART0 in msf_power_low needs OSCERCLK in the stop modes */
+	msf_lowpower_oscer(uart_lp_client(uart), (state == msf_power_low) && uart->reg);
+#endif
+	return MSF_ERROR_OK;
 } 
 
 /* Instance specific function pointed-to from the driver access struct */
@@ -833,6 +945,9 @@ static uint32_t UART2_DataAvailable(void)
 /* Interrupt handler for UART 0 only! */
 void UART0_handleIRQ( UART_RESOURCES* uart)
 {	
+	/* Rx active edge - the wake-up in msf_power_low state; just clear the flag */
+	if ( uart->reg->S2 & UART0_S2_RXEDGIF_MASK )
+		uart->reg->S2 = (uart->reg->S2 & ~UART0_S2_LBKDIF_MASK) | UART0_S2_RXEDGIF_MASK;
 	
 	/* sanity check - are we in interrupt mode? we should not be called if not. */
 	if ( (uart->info->status & MSF_UART_STATUS_INT_MODE) == 0 )
@@ -922,6 +1037,10 @@ void UART0_handleIRQ( UART_RESOURCES* uart)
 /* Common interrupt handler for UART1 and 2 */
 void UART_handleIRQ( UART_RESOURCES* uart)
 {		
+	/* Rx active edge - the wake-up in msf_power_low state; just clear the flag */
+	if ( uart->reg1->S2 & UART_S2_RXEDGIF_MASK )
+		uart->reg1->S2 = (uart->reg1->S2 & ~UART_S2_LBKDIF_MASK) | UART_S2_RXEDGIF_MASK;
+	
 	/* sanity check - are we in interrupt mode? we should not be called if not. */
 	if ( (uart->info->status & MSF_UART_STATUS_INT_MODE) == 0 )
 		return;
@@ -1091,9 +1210,14 @@ static uint32_t uart1_setbaudrate(uint32_t baudrate, UART_RESOURCES* uart)
 	uint32_t sbr_val, reg_temp;
 	
 	/* assert(uart->reg == 0) calling us for uart0 is error */
+#if MSF_CLOCK_SWITCH
+	sbr_val = uart1_scale_br(baudrate, msf_clock_bus());
+#else
 	sbr_val = UART_GET_BR_UART1(baudrate);	
+#endif
 	if (sbr_val == 0 )
 		return 0;
+	uart->info->baudrate = baudrate;
 	/* Save current value of uartx_BDH except for the SBR field */
 	reg_temp = uart->reg1->BDH & ~(UART_BDH_SBR(0x1F));
 	/* write new value */  
@@ -1102,6 +1226,75 @@ static uint32_t uart1_setbaudrate(uint32_t baudrate, UART_RESOURCES* uart)
 	return 1;
 }
 
+#if MSF_CLOCK_SWITCH
+/* Get the BR for UART1/2 at given bus clock; 0 if the baudrate would differ from the
+ * baudrate at the nominal clock by more than MSF_CLOCK_BAUD_TOLERANCE.
+ * The enum value is for the nominal bus clock; BR is proportional to the bus clock. 
+ * Computed in kHz so that it fits 32 bits (BR is 13-bit) */
+static uint32_t uart1_scale_br(uint32_t baudrate, uint32_t bus_clock)
+{
+	uint32_t exact, sbr_val, diff;
+	
+	/* the exact BR multiplied by the nominal clock in kHz */
+	exact = UART_GET_BR_UART1(baudrate) * (bus_clock / 1000u);
+	sbr_val = (exact + (UART_BUS_CLOCK_NOMINAL / 2000u)) / (UART_BUS_CLOCK_NOMINAL / 1000u);
+	if ( sbr_val == 0 )
+		return 0;
+	
+	/* the baudrate is inversely proportional to BR, so the relative error is the same */
+	diff = sbr_val * (UART_BUS_CLOCK_NOMINAL / 1000u);
+	diff = (diff > exact) ? (diff - exact) : (exact - diff);
+	if ( (diff * 1000u) / exact > MSF_CLOCK_BAUD_TOLERANCE )
+		return 0;
+	return sbr_val;
+}
+
+/* Called by msf_clock_set before and after the bus clock changed. 
+ * Before: refuse the clock if the baudrate of an initialized UART1/2 cannot be set precisely enough.
+ * After: set the baudrate again for the new bus clock (not if its clock is disabled by 
+ * PowerControl; it is set when the power is turned on). */
+static uint8_t uart1_clock_changed(uint32_t bus_clock, bool check)
+{
+#if (MSF_DRIVER_UART1)
+	if ( UART1_Info.baudrate != 0 )
+	{
+		if ( check && uart1_scale_br(UART1_Info.baudrate, bus_clock) == 0 )
+			return MSF_ERROR_NOTSUPPORTED;
+		if ( !check && (SIM->SCGC4 & SIM_SCGC4_UART1_MASK) )
+			uart1_setbaudrate(UART1_Info.baudrate, &UART1_Resources);
+	}
+#endif
+#if (MSF_DRIVER_UART2)
+	if ( UART2_Info.baudrate != 0 )
+	{
+		if ( check && uart1_scale_br(UART2_Info.baudrate, bus_clock) == 0 )
+			return MSF_ERROR_NOTSUPPORTED;
+		if ( !check && (SIM->SCGC4 & SIM_SCGC4_UART2_MASK) )
+			uart1_setbaudrate(UART2_Info.baudrate, &UART2_Resources);
+	}
+#endif
+	return MSF_ERROR_OK;
+}
+#endif	/* MSF_CLOCK_SWITCH */
+
+/* Get the mask of the clock gate bit in SIM_SCGC4 for the UART */
+static uint32_t uart_gate_mask(UART_RESOURCES* uart)
+{
+	if ( uart->reg )
+		return SIM_SCGC4_UART0_MASK;
+	return (uart->reg1 == UART1) ? SIM_SCGC4_UART1_MASK : SIM_SCGC4_UART2_MASK;
+}
+
+#if MSF_LOWPOWER
+/* Get the client of the low-power manager for the UART */
+static uint32_t uart_lp_client(UART_RESOURCES* uart)
+{
+	if ( uart->reg )
+		return MSF_LP_UART0;
+	return (uart->reg1 == UART1) ? MSF_LP_UART1 : MSF_LP_UART2;
+}
+#endif
+
 /* Configure interrupt for UART1 or 2 
  * enable = 0 > disable interrupt; anything else >  enablke int*/
 static void uart1_intconfig(uint32_t enable, UART_RESOURCES* uart)
@@ -40,6 +40,7 @@ typedef struct _UART_INFO {
   uint32_t  rx_cnt;				// number of bytes already transmitted
   uint32_t  tx_total;			// total number of bytes to receive or transmit
   uint32_t  rx_total;			// total number of bytes to receive or transmit
+  uint32_t  baudrate;			// the baudrate set for UART1/2 (UART_speed_t value)
 } UART_INFO;
 
 /** UART pin info 
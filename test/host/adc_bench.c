@@ -0,0 +1,341 @@
+/****************************************************************************
+ * @file     adc_bench.c
+ * @brief    Host benchmark of the ADC driver and msf_analog_read
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	Build and run on PC (from the root of MSF):
+ * 			gcc -std=gnu99 -O2 -Wall -Wno-int-to-pointer-cast -Itest/host/sim
+ * 				-Iexamples/kds/frdm_kl25z/adc_benchmark/Includes -Iboard/frdm_kl25z
+ * 				-Iplatform/kinetis -Iplatform/kinetis/mkl25z -Icommon
+ * 				platform/kinetis/adc_kl25.c platform/kinetis/msf_analog.c
+ * 				test/host/sim/sim_mkl25z.c test/host/adc_bench.c -o adc_bench
+ * 			./adc_bench [name=value ...] > adc.csv
+ *
+ * 			The driver runs unchanged against the simulated ADC_Type (see
+ * 			test/host/sim/derivative.h). The conversion is completed by sim_adc_complete,
+ * 			which adds the conversion time computed from the ADC registers to the
+ * 			simulated time:
+ * 			sfc_adck + avg * (bct + lst_adck + hsc_adck) ADCK cycles + sfc_bus bus cycles,
+ * 			where ADCK = bus >> ADIV and bct is the base conversion time for the resolution
+ * 			(the KL25 datasheet values). In continuous mode only the first conversion
+ * 			has the sfc adders. The parameters of the model can be changed on the
+ * 			command line, e.g. "bus=20970000 lst_adck=20"; see g_model_params.
+ *
+ * 			The output is CSV, one line per mode and configuration, the same columns
+ * 			as in the adc_benchmark example for the board:
+ * 			mode,res_bits,avg,reads,conv_ns,driver_ns,conv_per_s
+ * 			mode - single (msf_analog_read of one pin), scan (msf_analog_read of pins
+ * 				which need A/B mux switching), stream (continuous conversions in interrupt
+ * 				mode, the ISR reports the results) and bare_single, bare_scan, bare_stream
+ * 				(the same register accesses without the driver)
+ * 			conv_ns - simulated conversion time per read
+ * 			driver_ns - host time per read minus the time of the bare mode, i.e. the
+ * 				overhead of the driver and msf_analog_read (0 for the bare modes)
+ * 			conv_per_s - conversions per second: the conversion time and the driver time
+ * 				scaled by cpu_ratio add up in single and scan modes; in stream mode the
+ * 				ISR runs during the next conversion, so the slower of the two limits the rate.
+ * 			The host is much faster than the Cortex-M0+; set cpu_ratio (target time per
+ * 			host time) to get the rates for the board. Compare driver_ns between
+ * 			the runs on the same host to track the overhead.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "msf_config.h"
+#include "coredef.h"
+#include "msf.h"
+#include "drv_adc.h"
+
+/* Number of readings for each measurement */
+#define		BENCH_READS			(200000UL)
+
+/* The pin used in single and stream modes; available in both A and B mux setting */
+#define		BENCH_PIN			AIN_B0
+
+/* The pins used in scan mode; E21 is available only with ADC A and D1 only with
+ * ADC B, so the mux must be switched for these. The same as in the board benchmark. */
+static const Analog_pin_t bench_scan_pins[] = { AIN_E20, AIN_E21, AIN_D1, AIN_B0 };
+#define		BENCH_SCAN_PINS		(sizeof(bench_scan_pins)/sizeof(bench_scan_pins[0]))
+
+/* The tested configurations */
+static const uint32_t bench_res_flags[] = { MSF_ADC_RES_8_BITS, MSF_ADC_RES_10_BITS,
+		MSF_ADC_RES_12_BITS, MSF_ADC_RES_16_BITS };
+static const uint8_t bench_res_bits[] = { 8, 10, 12, 16 };
+
+static const uint32_t bench_avg_flags[] = { MSF_ADC_AVERAGE_NONE, MSF_ADC_AVERAGE_4,
+		MSF_ADC_AVERAGE_8, MSF_ADC_AVERAGE_16, MSF_ADC_AVERAGE_32 };
+static const uint8_t bench_avg_samples[] = { 1, 4, 8, 16, 32 };
+
+/* The handler in the driver */
+extern void ADC0_IRQHandler(void);
+
+/* The conversion time model */
+typedef struct {
+	double bus;			/* bus clock in Hz; ADICLK selects the bus clock */
+	double sfc_adck;	/* single or first continuous conversion adder in ADCK cycles */
+	double sfc_bus;		/* and in bus cycles */
+	double bct8;		/* base conversion time in ADCK cycles for 8, 10, 12 and 16 bits */
+	double bct10;
+	double bct12;
+	double bct16;
+	double lst_adck;	/* long sample time adder (CFG1[ADLSMP] = 1 and CFG2[ADLSTS] = 0) */
+	double hsc_adck;	/* high speed conversion adder (CFG2[ADHSC] = 1) */
+	double cal_adck;	/* calibration time */
+	double cpu_ratio;	/* time of the driver code on the target per time on the host */
+} BENCH_MODEL;
+
+static BENCH_MODEL g_model = { F_BUS, 3, 5, 17, 20, 20, 25, 20, 2, 3000, 1 };
+
+/* The names for setting the model from the command line */
+static const struct {
+	const char* name;
+	double* value;
+} g_model_params[] = {
+	{ "bus", &g_model.bus }, { "sfc_adck", &g_model.sfc_adck }, { "sfc_bus", &g_model.sfc_bus },
+	{ "bct8", &g_model.bct8 }, { "bct10", &g_model.bct10 }, { "bct12", &g_model.bct12 },
+	{ "bct16", &g_model.bct16 }, { "lst_adck", &g_model.lst_adck }, { "hsc_adck", &g_model.hsc_adck },
+	{ "cal_adck", &g_model.cal_adck }, { "cpu_ratio", &g_model.cpu_ratio },
+};
+
+/* Simulated time of the conversions in ns */
+static double g_sim_ns;
+/* Continuous conversions are running; the next one has no sfc adder */
+static uint8_t g_sim_running;
+/* Conversions completed in stream mode */
+static volatile uint32_t g_stream_cnt;
+static volatile uint32_t g_sink;
+
+/* Complete the conversion (or calibration) started in the ADC registers;
+ * called by the driver through WMSF_ADCA_COMPLETE */
+uint32_t sim_adc_complete(ADC_Type* reg)
+{
+	static const uint8_t res_bits[4] = { 8, 12, 10, 16 };	/* CFG1[MODE] */
+	double adck = g_model.bus / (double)(1UL << ((reg->CFG1 & ADC_CFG1_ADIV_MASK) >> ADC_CFG1_ADIV_SHIFT));
+	uint32_t mode = (reg->CFG1 & ADC_CFG1_MODE_MASK) >> ADC_CFG1_MODE_SHIFT;
+	uint32_t channel = (reg->SC1[0] & ADC_SC1_ADCH_MASK) >> ADC_SC1_ADCH_SHIFT;
+	double bct, cycles, avg = 1;
+
+	if ( reg->SC3 & ADC_SC3_CAL_MASK )
+	{
+		/* calibration; the driver computes the gains from these plus and minus side values */
+		g_sim_ns += g_model.cal_adck * 1e9 / adck;
+		reg->CLP0 = reg->CLP1 = reg->CLP2 = reg->CLP3 = reg->CLP4 = reg->CLPS = 0x2000;
+		reg->CLM0 = reg->CLM1 = reg->CLM2 = reg->CLM3 = reg->CLM4 = reg->CLMS = 0x2000;
+		return 1;
+	}
+	if ( channel == AIN_ADC_DISALED )
+		return 0;
+
+	bct = (mode == 0) ? g_model.bct8 : (mode == 1) ? g_model.bct12
+			: (mode == 2) ? g_model.bct10 : g_model.bct16;
+	if ( reg->SC3 & ADC_SC3_AVGE_MASK )
+		avg = (double)(4UL << (reg->SC3 & ADC_SC3_AVGS_MASK));
+	cycles = avg * (bct + ((reg->CFG1 & ADC_CFG1_ADLSMP_MASK) ? g_model.lst_adck : 0)
+			+ ((reg->CFG2 & ADC_CFG2_ADHSC_MASK) ? g_model.hsc_adck : 0));
+
+	if ( (reg->SC3 & ADC_SC3_ADCO_MASK) && g_sim_running )
+		g_sim_ns += cycles * 1e9 / adck;
+	else
+		g_sim_ns += (cycles + g_model.sfc_adck) * 1e9 / adck + g_model.sfc_bus * 1e9 / g_model.bus;
+	g_sim_running = (reg->SC3 & ADC_SC3_ADCO_MASK) != 0;
+
+	/* a different value for each channel and conversion; R is read-only for the driver */
+	*(volatile uint32_t*)&reg->R[0] = ((channel << 11) + (uint32_t)g_sim_ns) & ((1UL << res_bits[mode]) - 1);
+	return 1;
+}
+
+/* Host time in ns */
+static double bench_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* Callback for the ADC driver */
+static void bench_event(uint32_t event, uint32_t arg)
+{
+	if ( event & MSF_ADC_EVENT_CONV_COMPLETE )
+		g_stream_cnt++;
+	g_sink += arg;
+}
+
+/* Read one pin using msf_analog_read */
+static void bench_single(void)
+{
+	uint32_t n;
+
+	for ( n = 0; n < BENCH_READS; n++ )
+		g_sink += msf_analog_read(BENCH_PIN);
+}
+
+/* Read several pins in turn using msf_analog_read */
+static void bench_scan(void)
+{
+	uint32_t n;
+
+	for ( n = 0; n < BENCH_READS; n++ )
+		g_sink += msf_analog_read(bench_scan_pins[n % BENCH_SCAN_PINS]);
+}
+
+/* Continuous conversions in interrupt mode; the ISR is called for each conversion */
+static void bench_stream(void)
+{
+	uint32_t n;
+
+	Driver_ADC0.SetChannel(MSF_PIN2CHANNEL(BENCH_PIN));
+	Driver_ADC0.Control(MSF_ADC_MODE_INT | MSF_ADC_CONV_CONTINUOUS, 0);
+	g_stream_cnt = 0;
+	Driver_ADC0.Read();		/* start the conversions */
+	for ( n = 0; n < BENCH_READS; n++ )
+		ADC0_IRQHandler();
+	Driver_ADC0.Control(MSF_ADC_MODE_POLLED | MSF_ADC_CONV_SINGLE, 0);
+}
+
+/* The same register accesses without the driver */
+static void bench_bare_single(void)
+{
+	uint32_t n;
+	uint32_t channel = MSF_PIN2CHANNEL(BENCH_PIN);
+
+	for ( n = 0; n < BENCH_READS; n++ )
+	{
+		ADC0->SC1[0] = ADC_SC1_ADCH(channel);
+		while ( !WMSF_ADCA_COMPLETE(ADC0) ) ;
+		g_sink += ADC0->R[0];
+	}
+}
+
+static void bench_bare_scan(void)
+{
+	uint32_t n;
+	Analog_pin_t pin;
+
+	for ( n = 0; n < BENCH_READS; n++ )
+	{
+		pin = bench_scan_pins[n % BENCH_SCAN_PINS];
+		if ( ((uint32_t)pin & MSF_ADC_BOTH) != MSF_ADC_BOTH )
+		{
+			if ( MSF_ADC_ISA_CHANNEL(pin) )
+				ADC0->CFG2 &= ~ADC_CFG2_MUXSEL_MASK;
+			else
+				ADC0->CFG2 |= ADC_CFG2_MUXSEL_MASK;
+		}
+		ADC0->SC1[0] = ADC_SC1_ADCH(MSF_PIN2CHANNEL(pin));
+		while ( !WMSF_ADCA_COMPLETE(ADC0) ) ;
+		g_sink += ADC0->R[0];
+	}
+}
+
+static void bench_bare_stream(void)
+{
+	uint32_t n;
+
+	ADC0->SC3 |= ADC_SC3_ADCO_MASK;
+	ADC0->SC1[0] = ADC_SC1_AIEN_MASK | ADC_SC1_ADCH(MSF_PIN2CHANNEL(BENCH_PIN));
+	for ( n = 0; n < BENCH_READS; n++ )
+	{
+		if ( WMSF_ADCA_COMPLETE(ADC0) )
+			bench_event(MSF_ADC_EVENT_CONV_COMPLETE, ADC0->R[0]);
+	}
+	ADC0->SC1[0] = ADC_SC1_ADCH(AIN_ADC_DISALED);
+	ADC0->SC3 &= ~ADC_SC3_ADCO_MASK;
+	g_sim_running = 0;
+}
+
+/* Run one measurement; return the host time per read in ns and
+ * the simulated conversion time per read in *conv_ns */
+static double bench_run(void (*fn)(void), double* conv_ns)
+{
+	double t;
+
+	g_sim_ns = 0;
+	t = bench_now();
+	fn();
+	t = bench_now() - t;
+	*conv_ns = g_sim_ns / BENCH_READS;
+	return t / BENCH_READS;
+}
+
+/* Print one line of the results; host_ns and ref_ns are the host times per read
+ * of the mode and of its bare version */
+static void bench_print(const char* mode, uint8_t res, uint8_t avg, double conv_ns,
+		double host_ns, double ref_ns, int stream)
+{
+	double driver_ns = (host_ns > ref_ns) ? host_ns - ref_ns : 0;
+	double cpu_ns = host_ns * g_model.cpu_ratio;
+	double period;
+
+	if ( stream )
+		period = (cpu_ns > conv_ns) ? cpu_ns : conv_ns;
+	else
+		period = conv_ns + cpu_ns;
+
+	printf("%s,%u,%u,%lu,%.1f,%.1f,%.0f\n", mode, res, avg, BENCH_READS, conv_ns, driver_ns,
+			(period > 0) ? 1e9 / period : 0);
+}
+
+int main(int argc, char* argv[])
+{
+	uint32_t r, a, p;
+	int i;
+	double conv, ref, t;
+	char* eq;
+
+	for ( i = 1; i < argc; i++ )
+	{
+		eq = strchr(argv[i], '=');
+		for ( p = 0; eq && p < sizeof(g_model_params)/sizeof(g_model_params[0]); p++ )
+		{
+			if ( strncmp(argv[i], g_model_params[p].name, (size_t)(eq - argv[i])) == 0
+					&& g_model_params[p].name[eq - argv[i]] == 0 )
+				break;
+		}
+		if ( eq == NULL || p == sizeof(g_model_params)/sizeof(g_model_params[0]) )
+		{
+			fprintf(stderr, "unknown parameter %s\n", argv[i]);
+			return 1;
+		}
+		*g_model_params[p].value = atof(eq + 1);
+	}
+
+	Driver_ADC0.Initialize(bench_event);
+
+	printf("mode,res_bits,avg,reads,conv_ns,driver_ns,conv_per_s\n");
+	for ( r = 0; r < sizeof(bench_res_flags)/sizeof(bench_res_flags[0]); r++ )
+	{
+		for ( a = 0; a < sizeof(bench_avg_flags)/sizeof(bench_avg_flags[0]); a++ )
+		{
+			Driver_ADC0.Control(bench_res_flags[r] | bench_avg_flags[a], 0);
+
+			ref = bench_run(bench_bare_single, &conv);
+			bench_print("bare_single", bench_res_bits[r], bench_avg_samples[a], conv, ref, ref, 0);
+			t = bench_run(bench_single, &conv);
+			bench_print("single", bench_res_bits[r], bench_avg_samples[a], conv, t, ref, 0);
+
+			ref = bench_run(bench_bare_scan, &conv);
+			bench_print("bare_scan", bench_res_bits[r], bench_avg_samples[a], conv, ref, ref, 0);
+			t = bench_run(bench_scan, &conv);
+			bench_print("scan", bench_res_bits[r], bench_avg_samples[a], conv, t, ref, 0);
+
+			ref = bench_run(bench_bare_stream, &conv);
+			bench_print("bare_stream", bench_res_bits[r], bench_avg_samples[a], conv, ref, ref, 1);
+			t = bench_run(bench_stream, &conv);
+			bench_print("stream", bench_res_bits[r], bench_avg_samples[a], conv, t, ref, 1);
+			if ( g_stream_cnt != BENCH_READS )
+			{
+				fprintf(stderr, "stream mode: %lu results reported, expected %lu\n",
+						(unsigned long)g_stream_cnt, BENCH_READS);
+				return 1;
+			}
+		}
+	}
+
+	return (int)(g_sink & 0);
+}
@@ -0,0 +1,142 @@
+/****************************************************************************
+ * @file     encoder_test.c
+ * @brief    Host tests of the quadrature decoding of the encoder module
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	Build and run on PC (from the root of MSF):
+ * 			gcc -std=c99 -Wall -DENCODER_HOST=1 -Icommon common/encoder.c test/host/encoder_test.c -o encoder_test
+ * 			./encoder_test
+ * 			The program returns 0 if all the tests pass.
+ *
+ * 			The edges are synthetic: the levels of A and B and the time stamps are
+ * 			passed to encoder_edge directly, so the results are exact.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "encoder.h"
+
+/* Frequency of the time stamps and the interval between the edges */
+#define		TEST_TICK_RATE	(1000000UL)
+#define		TEST_INTERVAL	(100)
+
+static int g_failed;
+
+/* The levels AB in forward order (A leads B): 00 -> 10 -> 11 -> 01 */
+static const uint8_t g_forward[4] = { 0, 2, 3, 1 };
+
+static void test_check(const char* name, int32_t value, int32_t expected)
+{
+	if ( value != expected )
+	{
+		printf("FAIL %s: got %ld, expected %ld\n", name, (long)value, (long)expected);
+		g_failed++;
+	}
+	else
+		printf("ok   %s (%ld)\n", name, (long)value);
+}
+
+/* Generate n edges in given direction (+1 or -1) starting at the phase *step;
+ * return the time of the last edge */
+static uint32_t test_run(ENCODER* enc, int n, int dir, uint8_t* step, uint32_t time)
+{
+	while ( n-- > 0 )
+	{
+		*step = (uint8_t)((*step + dir) & 3);
+		time += TEST_INTERVAL;
+		encoder_edge(enc, g_forward[*step], time);
+	}
+	return time;
+}
+
+static void test_forward_reverse(void)
+{
+	ENCODER enc;
+	uint8_t step = 0;
+	uint32_t t;
+
+	encoder_init(&enc, 4, TEST_TICK_RATE, g_forward[0]);
+	t = test_run(&enc, 10, +1, &step, 0);
+	test_check("forward position", encoder_position(&enc), 10);
+	test_check("forward velocity", encoder_velocity_at(&enc, t), TEST_TICK_RATE / TEST_INTERVAL);
+
+	t = test_run(&enc, 25, -1, &step, t);
+	test_check("reverse position", encoder_position(&enc), -15);
+	test_check("reverse velocity", encoder_velocity_at(&enc, t), -(int32_t)(TEST_TICK_RATE / TEST_INTERVAL));
+	test_check("no errors", (int32_t)encoder_errors(&enc), 0);
+
+	/* the encoder stops: the velocity decreases as if the next edge came now;
+	 * window 4 edges = 400 ticks + 900 ticks late */
+	test_check("velocity after stop", encoder_velocity_at(&enc, t + 1000), -(int32_t)(4 * TEST_TICK_RATE / 1300));
+
+	encoder_set_position(&enc, 100);
+	test_run(&enc, 3, +1, &step, t);
+	test_check("set position", encoder_position(&enc), 103);
+}
+
+static void test_direction_change(void)
+{
+	ENCODER enc;
+	uint8_t step = 0;
+	uint32_t t;
+
+	/* after a reversal, the velocity uses only the edges in the new direction */
+	encoder_init(&enc, 8, TEST_TICK_RATE, g_forward[0]);
+	t = test_run(&enc, 20, +1, &step, 0);
+	test_check("before reversal", encoder_velocity_at(&enc, t), TEST_TICK_RATE / TEST_INTERVAL);
+	t = test_run(&enc, 1, -1, &step, t);
+	test_check("one edge after reversal", encoder_velocity_at(&enc, t), 0);
+	t = test_run(&enc, 2, -1, &step, t);
+	test_check("three edges after reversal", encoder_velocity_at(&enc, t), -(int32_t)(TEST_TICK_RATE / TEST_INTERVAL));
+}
+
+static void test_invalid(void)
+{
+	ENCODER enc;
+
+	encoder_init(&enc, 4, TEST_TICK_RATE, 0);
+	encoder_edge(&enc, 0, 100);		/* no change */
+	encoder_edge(&enc, 3, 200);		/* 00 -> 11: both signals changed */
+	encoder_edge(&enc, 0, 300);		/* 11 -> 00 */
+	encoder_edge(&enc, 2, 400);		/* 00 -> 10: valid again */
+	encoder_edge(&enc, 1, 500);		/* 10 -> 01 */
+	test_check("invalid transitions", (int32_t)encoder_errors(&enc), 3);
+	test_check("position after invalid", encoder_position(&enc), 1);
+
+	if ( encoder_init(&enc, 0, TEST_TICK_RATE, 0) == 0 || encoder_init(&enc, ENCODER_HISTORY, TEST_TICK_RATE, 0) == 0 )
+	{
+		printf("FAIL invalid window accepted\n");
+		g_failed++;
+	}
+	else
+		printf("ok   invalid window rejected\n");
+}
+
+static void test_time_wrap(void)
+{
+	ENCODER enc;
+	uint8_t step = 0;
+	uint32_t t;
+
+	/* the time stamps wrap around 32 bits during the window */
+	encoder_init(&enc, 4, TEST_TICK_RATE, g_forward[0]);
+	t = test_run(&enc, 6, +1, &step, 0xFFFFFFFFUL - 3 * TEST_INTERVAL);
+	test_check("velocity over time wrap", encoder_velocity_at(&enc, t), TEST_TICK_RATE / TEST_INTERVAL);
+}
+
+int main(void)
+{
+	test_forward_reverse();
+	test_direction_change();
+	test_invalid();
+	test_time_wrap();
+
+	if ( g_failed )
+		printf("%d test(s) FAILED\n", g_failed);
+	else
+		printf("All tests passed\n");
+	return g_failed ? 1 : 0;
+}
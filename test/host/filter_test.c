@@ -0,0 +1,297 @@
+/****************************************************************************
+ * @file     filter_test.c
+ * @brief    Host tests of the filter module against double-precision reference
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	Build and run on PC (from the root of MSF):
+ * 			gcc -std=c99 -Wall -DFILTER_HOST=1 -Icommon common/filter.c test/host/filter_test.c -lm -o filter_test
+ * 			./filter_test
+ * 			The program returns 0 if all the tests pass.
+ *
+ * 			Each filter is fed with the same pseudo-random signal (noise, steps, spikes
+ * 			and full-scale values), processed in blocks of varying size, and the output
+ * 			is compared with the same filter computed in double precision.
+ * 			The moving average, median and CIC must be bit-exact (the reference
+ * 			applies the same truncation to the exact double value). The IIR output must
+ * 			be bit-exact to the double model of the fixed-point recurrence and within
+ * 			1.5 LSB of the ideal floating-point IIR (the truncation in the accumulator
+ * 			keeps it less than 1 LSB above the ideal value, plus 0.5 LSB output rounding).
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "filter.h"
+
+/* Number of samples of the test signal */
+#define		TEST_SAMPLES	(20000)
+
+static uint16_t g_signal[TEST_SAMPLES];
+static uint16_t g_buf[TEST_SAMPLES];
+static double g_ref[TEST_SAMPLES];
+static int g_failed;
+
+/* Simple LCG so the signal is the same on every PC */
+static uint32_t g_seed = 12345;
+static uint32_t test_rand(void)
+{
+	g_seed = g_seed * 1103515245UL + 12345UL;
+	return g_seed >> 8;
+}
+
+/* Fill the test signal: slow ramp with noise, steps, single-sample spikes
+ * and runs of 0 and 0xFFFF (the extremes must not overflow the filters) */
+static void test_make_signal(void)
+{
+	uint32_t i;
+	int32_t v;
+
+	for ( i = 0; i < TEST_SAMPLES; i++ )
+	{
+		v = (int32_t)((i * 7) & 0xFFFF) + (int32_t)(test_rand() % 512) - 256;
+		if ( (i / 1000) % 4 == 1 )
+			v = 0xFFFF;
+		else if ( (i / 1000) % 4 == 3 && (i % 1000) < 300 )
+			v = 0;
+		if ( test_rand() % 50 == 0 )
+			v = test_rand() & 0xFFFF;	/* spike */
+		if ( v < 0 )
+			v = 0;
+		if ( v > 0xFFFF )
+			v = 0xFFFF;
+		g_signal[i] = (uint16_t)v;
+	}
+}
+
+/* Copy the signal to g_buf; it is processed in place */
+static void test_copy_signal(void)
+{
+	memcpy(g_buf, g_signal, sizeof(g_buf));
+}
+
+/* Next block size; blocks of 1 sample and odd sizes test keeping the state */
+static uint32_t test_block(uint32_t pos)
+{
+	static const uint32_t sizes[] = { 1, 7, 64, 3, 255, 16, 1000 };
+	uint32_t n = sizes[(pos / 7) % (sizeof(sizes)/sizeof(sizes[0]))];
+
+	if ( n > TEST_SAMPLES - pos )
+		n = TEST_SAMPLES - pos;
+	return n;
+}
+
+/* Compare n outputs with the reference; return max. difference */
+static double test_compare(const char* name, uint32_t n, double tolerance)
+{
+	uint32_t i;
+	double diff, max_diff = 0;
+
+	for ( i = 0; i < n; i++ )
+	{
+		diff = fabs((double)g_buf[i] - g_ref[i]);
+		if ( diff > max_diff )
+			max_diff = diff;
+		if ( diff > tolerance )
+		{
+			printf("FAIL %s: sample %u: got %u, reference %.3f\n", name, (unsigned)i,
+					(unsigned)g_buf[i], g_ref[i]);
+			g_failed++;
+			return max_diff;
+		}
+	}
+	printf("ok   %s (%u samples, max. difference %.3f)\n", name, (unsigned)n, max_diff);
+	return max_diff;
+}
+
+static void test_ma(uint8_t shift)
+{
+	static uint16_t history[1 << 8];
+	FILTER_MA f;
+	uint32_t i, k, pos, win = 1UL << shift;
+	double sum;
+	char name[32];
+
+	/* reference: truncated mean of the last 2^shift inputs; the inputs before
+	 * the start are equal to the initial value */
+	for ( i = 0; i < TEST_SAMPLES; i++ )
+	{
+		sum = 0;
+		for ( k = 0; k < win; k++ )
+			sum += (i >= k) ? g_signal[i - k] : g_signal[0];
+		g_ref[i] = floor(sum / win);
+	}
+
+	test_copy_signal();
+	filter_ma_init(&f, history, shift, g_signal[0]);
+	for ( pos = 0; pos < TEST_SAMPLES; pos += test_block(pos) )
+		filter_ma_process(&f, g_buf + pos, test_block(pos));
+
+	sprintf(name, "moving average 2^%u", shift);
+	test_compare(name, TEST_SAMPLES, 0);
+}
+
+static void test_iir(uint8_t shift)
+{
+	FILTER_IIR f;
+	uint32_t i, pos;
+	double scale = (double)(1UL << shift);
+	double acc, y;
+	char name[32];
+
+	/* reference 1: the fixed-point recurrence computed in double; bit-exact */
+	acc = g_signal[0] * scale;
+	for ( i = 0; i < TEST_SAMPLES; i++ )
+	{
+		acc = acc - floor(acc / scale) + g_signal[i];
+		g_ref[i] = floor(acc / scale + ((shift > 0) ? 0.5 : 0));
+	}
+
+	test_copy_signal();
+	filter_iir_init(&f, shift, g_signal[0]);
+	for ( pos = 0; pos < TEST_SAMPLES; pos += test_block(pos) )
+		filter_iir_process(&f, g_buf + pos, test_block(pos));
+
+	sprintf(name, "IIR 1/2^%u exact", shift);
+	test_compare(name, TEST_SAMPLES, 0);
+
+	/* reference 2: the ideal IIR y = y + (x - y) * alpha; max. 1.5 LSB error */
+	y = g_signal[0];
+	for ( i = 0; i < TEST_SAMPLES; i++ )
+	{
+		y = y + (g_signal[i] - y) / scale;
+		g_ref[i] = y;
+	}
+	sprintf(name, "IIR 1/2^%u ideal", shift);
+	test_compare(name, TEST_SAMPLES, 1.5);
+}
+
+static int test_cmp_double(const void* a, const void* b)
+{
+	double x = *(const double*)a, y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+static void test_median(uint8_t n)
+{
+	FILTER_MEDIAN f;
+	double window[FILTER_MEDIAN_MAX];
+	uint32_t i, k, pos;
+	char name[32];
+
+	/* reference: sorted last n inputs; the inputs before the start are the initial value */
+	for ( i = 0; i < TEST_SAMPLES; i++ )
+	{
+		for ( k = 0; k < n; k++ )
+			window[k] = (i >= k) ? g_signal[i - k] : g_signal[0];
+		qsort(window, n, sizeof(double), test_cmp_double);
+		g_ref[i] = window[n / 2];
+	}
+
+	test_copy_signal();
+	filter_median_init(&f, n, g_signal[0]);
+	for ( pos = 0; pos < TEST_SAMPLES; pos += test_block(pos) )
+		filter_median_process(&f, g_buf + pos, test_block(pos));
+
+	sprintf(name, "median of %u", n);
+	test_compare(name, TEST_SAMPLES, 0);
+}
+
+static void test_cic(uint8_t order, uint8_t rshift)
+{
+	static double stage[TEST_SAMPLES];
+	FILTER_CIC f;
+	uint32_t i, k, m, pos, out, r = 1UL << rshift;
+	double sum, gain = pow((double)r, order);
+	char name[32];
+
+	/* reference: CIC = order times moving sum of R samples (zero initial state),
+	 * every R-th output, divided by R^order and truncated */
+	for ( i = 0; i < TEST_SAMPLES; i++ )
+		g_ref[i] = g_signal[i];
+	for ( m = 0; m < order; m++ )
+	{
+		for ( i = 0; i < TEST_SAMPLES; i++ )
+		{
+			sum = 0;
+			for ( k = 0; k < r && k <= i; k++ )
+				sum += g_ref[i - k];
+			stage[i] = sum;
+		}
+		memcpy(g_ref, stage, sizeof(stage));
+	}
+	for ( i = 0; i < TEST_SAMPLES / r; i++ )
+		g_ref[i] = floor(g_ref[i * r + r - 1] / gain);
+
+	test_copy_signal();
+	filter_cic_init(&f, order, rshift);
+	out = 0;
+	for ( pos = 0; pos < TEST_SAMPLES; pos += test_block(pos) )
+	{
+		/* the output is written to the beginning of the block; move it after the
+		 * previous outputs (the block always starts after them) */
+		k = filter_cic_process(&f, g_buf + pos, test_block(pos));
+		memmove(g_buf + out, g_buf + pos, k * sizeof(uint16_t));
+		out += k;
+	}
+
+	sprintf(name, "CIC M=%u R=%u", order, (unsigned)r);
+	if ( out != TEST_SAMPLES / r )
+	{
+		printf("FAIL %s: %u outputs, expected %u\n", name, (unsigned)out, (unsigned)(TEST_SAMPLES / r));
+		g_failed++;
+		return;
+	}
+	test_compare(name, out, 0);
+}
+
+/* The init functions must reject invalid parameters */
+static void test_arguments(void)
+{
+	FILTER_MA ma;
+	FILTER_IIR iir;
+	FILTER_MEDIAN med;
+	FILTER_CIC cic;
+	uint16_t history[1];
+
+	if ( filter_ma_init(&ma, history, 17, 0) == 0 || filter_ma_init(&ma, NULL, 0, 0) == 0
+		|| filter_iir_init(&iir, 16, 0) == 0
+		|| filter_median_init(&med, 4, 0) == 0 || filter_median_init(&med, FILTER_MEDIAN_MAX + 2, 0) == 0
+		|| filter_cic_init(&cic, 0, 2) == 0 || filter_cic_init(&cic, 2, 0) == 0
+		|| filter_cic_init(&cic, 3, 6) == 0 )
+	{
+		printf("FAIL invalid arguments accepted\n");
+		g_failed++;
+	}
+	else
+		printf("ok   invalid arguments rejected\n");
+}
+
+int main(void)
+{
+	uint8_t i;
+
+	test_make_signal();
+	test_arguments();
+
+	for ( i = 0; i <= 8; i += 2 )
+		test_ma(i);
+	for ( i = 0; i <= 15; i += 3 )
+		test_iir(i);
+	for ( i = 3; i <= FILTER_MEDIAN_MAX; i += 2 )
+		test_median(i);
+	test_cic(1, 4);
+	test_cic(2, 3);
+	test_cic(3, 5);
+	test_cic(2, 8);
+
+	if ( g_failed )
+		printf("%d test(s) FAILED\n", g_failed);
+	else
+		printf("All tests passed\n");
+	return g_failed ? 1 : 0;
+}
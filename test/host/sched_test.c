@@ -0,0 +1,197 @@
+/****************************************************************************
+ * @file     sched_test.c
+ * @brief    Host tests of the task scheduler
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	Build and run on PC (from the root of MSF):
+ * 			gcc -std=c99 -Wall -DSCHED_HOST=1 -DSCHED_MAX_TASKS=32 -Icommon common/sched.c test/host/sched_test.c -o sched_test
+ * 			./sched_test
+ * 			The program returns 0 if all the tests pass.
+ *
+ * 			The events are posted and the tasks dispatched by the test itself
+ * 			(sched_run is not used), so the order of the runs is deterministic.
+ * 			SCHED_MAX_TASKS must be at least 6.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sched.h"
+
+/* The runs of the tasks in the order of dispatch */
+#define		TEST_LOG_SIZE	(64)
+
+static uint8_t g_log_task[TEST_LOG_SIZE];
+static uint32_t g_log_events[TEST_LOG_SIZE];
+static uint32_t g_log_count;
+static int g_failed;
+
+static void test_check(const char* name, uint32_t value, uint32_t expected)
+{
+	if ( value != expected )
+	{
+		printf("FAIL %s: got %lu, expected %lu\n", name, (unsigned long)value, (unsigned long)expected);
+		g_failed++;
+	}
+	else
+		printf("ok   %s\n", name);
+}
+
+static void test_log(uint8_t task, uint32_t events)
+{
+	if ( g_log_count < TEST_LOG_SIZE )
+	{
+		g_log_task[g_log_count] = task;
+		g_log_events[g_log_count] = events;
+	}
+	g_log_count++;
+}
+
+/* Dispatch all the ready tasks; return the number of runs */
+static uint32_t test_dispatch_all(void)
+{
+	uint32_t n = 0;
+
+	g_log_count = 0;
+	while ( sched_dispatch() )
+		n++;
+	return n;
+}
+
+/* One task function for each priority; it logs its priority */
+#define	TEST_TASK(n)	static void test_task##n(uint32_t events) { test_log(n, events); }
+TEST_TASK(0) TEST_TASK(1) TEST_TASK(2) TEST_TASK(3) TEST_TASK(4) TEST_TASK(5) TEST_TASK(6) TEST_TASK(7)
+TEST_TASK(8) TEST_TASK(9) TEST_TASK(10) TEST_TASK(11) TEST_TASK(12) TEST_TASK(13) TEST_TASK(14) TEST_TASK(15)
+TEST_TASK(16) TEST_TASK(17) TEST_TASK(18) TEST_TASK(19) TEST_TASK(20) TEST_TASK(21) TEST_TASK(22) TEST_TASK(23)
+TEST_TASK(24) TEST_TASK(25) TEST_TASK(26) TEST_TASK(27) TEST_TASK(28) TEST_TASK(29) TEST_TASK(30) TEST_TASK(31)
+
+static const SCHED_Task_t g_tasks[32] = {
+	test_task0, test_task1, test_task2, test_task3, test_task4, test_task5, test_task6, test_task7,
+	test_task8, test_task9, test_task10, test_task11, test_task12, test_task13, test_task14, test_task15,
+	test_task16, test_task17, test_task18, test_task19, test_task20, test_task21, test_task22, test_task23,
+	test_task24, test_task25, test_task26, test_task27, test_task28, test_task29, test_task30, test_task31,
+};
+
+/* Task which posts to other tasks when it runs with the event 0x01 */
+static void test_poster(uint32_t events)
+{
+	test_log(SCHED_MAX_TASKS - 1, events);
+	if ( events & 0x01 )
+	{
+		sched_post(0, 0x10);					/* higher priority: must run next */
+		sched_post(SCHED_MAX_TASKS - 1, 0x20);	/* itself: runs again after task 0 */
+	}
+}
+
+static void test_create(void)
+{
+	uint8_t ok;
+
+	ok = sched_task_create(SCHED_MAX_TASKS, test_task0) != 0
+		&& sched_task_create(0, 0) != 0
+		&& sched_task_create(0, test_task0) == 0
+		&& sched_task_create(0, test_task1) != 0;
+	sched_task_delete(0);
+	test_check("create rejects invalid priority, null task and used priority", ok, 1);
+}
+
+static void test_priorities(void)
+{
+	uint8_t i, order_ok = 1;
+
+	for ( i = 0; i < SCHED_MAX_TASKS; i++ )
+		sched_task_create(i, g_tasks[i]);
+
+	/* post in reverse order; the runs must be in the order of priority */
+	for ( i = SCHED_MAX_TASKS; i > 0; i-- )
+		sched_post(i - 1, 1UL << (i - 1));
+	test_check("all tasks run once", test_dispatch_all(), SCHED_MAX_TASKS);
+	for ( i = 0; i < SCHED_MAX_TASKS; i++ )
+	{
+		if ( g_log_task[i] != i || g_log_events[i] != (1UL << i) )
+			order_ok = 0;
+	}
+	test_check("tasks run in the order of priority", order_ok, 1);
+
+	/* the order does not depend on the order of posting */
+	sched_post(SCHED_MAX_TASKS - 1, 0x1);
+	sched_post(2, 0x2);
+	sched_post(1, 0x4);
+	test_dispatch_all();
+	test_check("priority 1 first", g_log_task[0], 1);
+	test_check("then priority 2", g_log_task[1], 2);
+
+	for ( i = 0; i < SCHED_MAX_TASKS; i++ )
+		sched_task_delete(i);
+}
+
+static void test_events(void)
+{
+	sched_task_create(3, test_task3);
+
+	/* the events posted before the task runs are merged into one run */
+	sched_post(3, 0x01);
+	sched_post(3, 0x04);
+	sched_post(3, 0x01);
+	sched_post(3, 0);		/* no events: ignored */
+	test_check("merged events run once", test_dispatch_all(), 1);
+	test_check("merged events", g_log_events[0], 0x05);
+	test_check("nothing to dispatch", sched_dispatch(), 0);
+
+	/* deleting discards the events; posting to a deleted task is ignored */
+	sched_post(3, 0x08);
+	sched_task_delete(3);
+	sched_post(3, 0x08);
+	sched_post(4, 0x08);
+	sched_post(SCHED_MAX_TASKS, 0x08);
+	test_check("no run after delete", test_dispatch_all(), 0);
+}
+
+static void test_post_from_task(void)
+{
+	sched_task_create(0, test_task0);
+	sched_task_create(SCHED_MAX_TASKS - 1, test_poster);
+
+	sched_post(SCHED_MAX_TASKS - 1, 0x01);
+	test_check("posts from a task run", test_dispatch_all(), 3);
+	/* the poster ran first; task 0 posted by it runs next, then the poster again */
+	test_check("poster first", g_log_task[0], SCHED_MAX_TASKS - 1);
+	test_check("then the task it posted", g_log_task[1], 0);
+	test_check("then the poster again", g_log_task[2], SCHED_MAX_TASKS - 1);
+	test_check("with its new events", g_log_events[2], 0x20);
+
+	sched_task_delete(SCHED_MAX_TASKS - 1);
+	sched_task_delete(0);
+}
+
+static void test_stats(void)
+{
+	SCHED_STATS stats;
+
+	sched_reset_stats();
+	sched_task_create(5, test_task5);
+	sched_post(5, 1);
+	test_dispatch_all();
+	sched_post(5, 1);
+	test_dispatch_all();
+	sched_get_stats(&stats);
+	test_check("dispatch count", stats.dispatches, 2);
+	sched_task_delete(5);
+}
+
+int main(void)
+{
+	test_create();
+	test_priorities();
+	test_events();
+	test_post_from_task();
+	test_stats();
+
+	if ( g_failed )
+		printf("%d test(s) FAILED\n", g_failed);
+	else
+		printf("All tests passed\n");
+	return g_failed ? 1 : 0;
+}
@@ -0,0 +1,112 @@
+/** derivative.h
+ * The derivative.h for the host builds of the drivers (test/host).
+ *
+ * Like the derivative.h in each project, it includes the CMSIS <device>.h for
+ * MKL25Z4, so the drivers get the real register structures and bit masks.
+ * The Cortex-M0+ core header is not included; instead:
+ * - the peripheral pointers (ADC0, TPM0,...) point to simulated register
+ *   blocks in RAM, defined in sim_mkl25z.c;
+ * - the NVIC functions and interrupt intrinsics are empty.
+ * The registers are plain memory: the flags are set and cleared by the test
+ * program, which also calls the interrupt handlers.
+ *
+ * Add -Itest/host/sim before the Includes directory of any example project,
+ * which provides the MKL25Z4.h. See the notes in test/host/adc_bench.c.
+*/
+
+#ifndef MSF_KINETIS_DERIVATIVE_H
+    #define MSF_KINETIS_DERIVATIVE_H
+
+/* Skip the core_cm0plus.h included by MKL25Z4.h; it needs an ARM compiler */
+#define	__CORE_CM0PLUS_H_GENERIC
+#define	__CORE_CM0PLUS_H_DEPENDANT
+#define	__I		volatile const
+#define	__O		volatile
+#define	__IO	volatile
+
+#include "MKL25Z4.h"
+
+/* The simulated peripherals */
+extern ADC_Type sim_adc0;
+extern DMA_Type sim_dma0;
+extern DMAMUX_Type sim_dmamux0;
+extern FGPIO_Type sim_fpt[5];
+extern GPIO_Type sim_pt[5];
+extern PMC_Type sim_pmc;
+extern PORT_Type sim_port[5];
+extern SIM_Type sim_sim;
+extern TPM_Type sim_tpm[3];
+
+#undef	ADC0
+#define	ADC0		(&sim_adc0)
+#undef	DMA0
+#define	DMA0		(&sim_dma0)
+#undef	DMAMUX0
+#define	DMAMUX0		(&sim_dmamux0)
+#undef	FPTA
+#define	FPTA		(&sim_fpt[0])
+#undef	FPTB
+#define	FPTB		(&sim_fpt[1])
+#undef	FPTC
+#define	FPTC		(&sim_fpt[2])
+#undef	FPTD
+#define	FPTD		(&sim_fpt[3])
+#undef	FPTE
+#define	FPTE		(&sim_fpt[4])
+#undef	PTA
+#define	PTA			(&sim_pt[0])
+#undef	PTB
+#define	PTB			(&sim_pt[1])
+#undef	PTC
+#define	PTC			(&sim_pt[2])
+#undef	PTD
+#define	PTD			(&sim_pt[3])
+#undef	PTE
+#define	PTE			(&sim_pt[4])
+#undef	PMC
+#define	PMC			(&sim_pmc)
+#undef	PORTA
+#define	PORTA		(&sim_port[0])
+#undef	PORTB
+#define	PORTB		(&sim_port[1])
+#undef	PORTC
+#define	PORTC		(&sim_port[2])
+#undef	PORTD
+#define	PORTD		(&sim_port[3])
+#undef	PORTE
+#define	PORTE		(&sim_port[4])
+#undef	SIM
+#define	SIM			(&sim_sim)
+#undef	TPM0
+#define	TPM0		(&sim_tpm[0])
+#undef	TPM1
+#define	TPM1		(&sim_tpm[1])
+#undef	TPM2
+#define	TPM2		(&sim_tpm[2])
+
+/* The GPIO and PORT of a pin (see gpio.h) */
+#define	GPIO_GPIO_OBJECT(pin)		(&sim_pt[(pin) & 0x00FF])
+#define	GPIO_PORT_OBJECT(pin)		(&sim_port[(pin) & 0x00FF])
+
+/* Completion of the ADC conversion; the test program models the conversion.
+ * Returns nonzero when the conversion (or calibration) started in reg is complete;
+ * the result is in reg->R[0] then. */
+uint32_t sim_adc_complete(ADC_Type* reg);
+#define	WMSF_ADCA_COMPLETE(reg)		(sim_adc_complete(reg) != 0)
+
+/* The core functions used by the drivers */
+#define	__enable_irq()
+#define	__disable_irq()
+#define	__WFI()
+#define	__NOP()
+#define	__DSB()
+#define	__ISB()
+#define	__get_PRIMASK()				(0)
+#define	__set_PRIMASK(x)			((void)(x))
+#define	NVIC_EnableIRQ(irqn)		((void)(irqn))
+#define	NVIC_DisableIRQ(irqn)		((void)(irqn))
+#define	NVIC_ClearPendingIRQ(irqn)	((void)(irqn))
+#define	NVIC_SetPendingIRQ(irqn)	((void)(irqn))
+#define	NVIC_SetPriority(irqn, p)	((void)(irqn), (void)(p))
+
+#endif // MSF_KINETIS_DERIVATIVE_H
@@ -0,0 +1,62 @@
+/****************************************************************************
+ * @file     msf_config.h
+ * @brief    Configuration for the host builds of the drivers (test/host)
+ * @note     Used with the derivative.h from this directory, which simulates
+ * the registers. Only the drivers tested on the host are enabled.
+ *
+ ******************************************************************************/
+#ifndef MSF_CONFIG_H
+	#define MSF_CONFIG_H
+
+#define F_CPU		(48000000)
+#define	F_BUS		(24000000)
+
+/* No console; the programs print to stdout */
+#define   MSF_USE_STDIO     0
+#define	 MSF_STDIO_BAUDRATE		(BD19200)
+
+#define MSF_USE_ANALOG      1
+
+#define MSF_DRIVER_UART0    0
+#define	MSF_DRIVER_UART1	0
+#define	MSF_DRIVER_UART2	0
+#define MSF_DRIVER_ADC0     1
+#define	MSF_DRIVER_TPM0		1
+#define	MSF_DRIVER_TPM1		1
+#define	MSF_DRIVER_TPM2		1
+
+#define	MSF_AWRITE_244HZ	0
+#define	MSF_AWRITE_500HZ	1
+#define	MSF_AWRITE_1KHZ		0
+#define	MSF_AWRITE_2KHZ		0
+#define	MSF_AWRITE_4KHZ		0
+#define	MSF_AWRITE_8KHZ		0
+#define	MSF_AWRITE_16KHZ	0
+#define	MSF_AWRITE_32KHZ	0
+
+/* Timer channel pins; the same as in the example projects */
+#define		MSF_TPM0_CH0_PIN	(GPIO_D0)
+#define		MSF_TPM0_CH0_ALT	(4)
+#define		MSF_TPM0_CH1_PIN	(GPIO_A4)
+#define		MSF_TPM0_CH1_ALT	(3)
+#define		MSF_TPM0_CH2_PIN	(GPIO_A5)
+#define		MSF_TPM0_CH2_ALT	(3)
+#define		MSF_TPM0_CH3_PIN	(GPIO_D3)
+#define		MSF_TPM0_CH3_ALT	(4)
+#define		MSF_TPM0_CH4_PIN	(GPIO_D4)
+#define		MSF_TPM0_CH4_ALT	(4)
+#define		MSF_TPM0_CH5_PIN	(GPIO_C9)
+#define		MSF_TPM0_CH5_ALT	(3)
+#define		MSF_TPM1_CH0_PIN	(GPIO_A12)
+#define		MSF_TPM1_CH0_ALT	(3)
+#define		MSF_TPM1_CH1_PIN	(GPIO_A13)
+#define		MSF_TPM1_CH1_ALT	(3)
+#define		MSF_TPM2_CH0_PIN	(GPIO_B2)
+#define		MSF_TPM2_CH0_ALT	(3)
+#define		MSF_TPM2_CH1_PIN	(GPIO_B3)
+#define		MSF_TPM2_CH1_ALT	(3)
+
+ /* Include the header file for our board */
+#include "frdm_kl25z.h" 
+
+#endif  /* MSF_CONFIG_H */
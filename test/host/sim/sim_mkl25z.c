@@ -0,0 +1,23 @@
+/****************************************************************************
+ * @file     sim_mkl25z.c
+ * @brief    Simulated peripheral registers for the host builds of the drivers
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	The peripheral pointers in derivative.h (this directory) point here.
+ * 			The registers are plain memory, all zero at start.
+ *
+ ******************************************************************************/
+
+#include "msf_config.h"
+#include "coredef.h"
+
+ADC_Type sim_adc0;
+DMA_Type sim_dma0;
+DMAMUX_Type sim_dmamux0;
+FGPIO_Type sim_fpt[5];
+GPIO_Type sim_pt[5];
+PMC_Type sim_pmc;
+PORT_Type sim_port[5];
+SIM_Type sim_sim;
+TPM_Type sim_tpm[3];
@@ -0,0 +1,174 @@
+/****************************************************************************
+ * @file     tpm_bench.c
+ * @brief    Host benchmark of the TPM interrupt handler - cycles per edge
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	Build and run on PC (from the root of MSF):
+ * 			gcc -std=gnu99 -O2 -Wall -Wno-int-to-pointer-cast -Itest/host/sim
+ * 				-Iexamples/kds/frdm_kl25z/tpm_timer/Includes -Iboard/frdm_kl25z
+ * 				-Iplatform/kinetis -Iplatform/kinetis/mkl25z -Icommon
+ * 				platform/kinetis/tpm_kl25.c test/host/sim/sim_mkl25z.c test/host/tpm_bench.c -o tpm_bench
+ * 			./tpm_bench > tpm.csv
+ *
+ * 			To measure the handler before the flag-driven dispatch, build the same way
+ * 			with the driver from the baseline commit instead of platform/kinetis/tpm_kl25.c
+ * 			and with -DBENCH_OLD_DRIVER=1 (that driver has no direct channel handlers):
+ * 			git show 64e4ed4:platform/kinetis/tpm_kl25.c > tpm_kl25_old.c
+ *
+ * 			The driver runs unchanged against the simulated TPM_Type (see
+ * 			test/host/sim/derivative.h). Before each call of TPM0_IRQHandler the flags of
+ * 			the first n channels are set in CnSC and STATUS, as the timer does for n edges
+ * 			captured at once; setting the flags is measured separately and subtracted.
+ * 			The time is measured by the time stamp counter on x86 (cycles at the nominal
+ * 			CPU frequency) or by clock_gettime on other hosts (then the result is in ns).
+ * 			The registers are plain memory, so the numbers show the relative cost of
+ * 			the handlers; the cycles on the Cortex-M0+ are different.
+ *
+ * 			The output is CSV, one line per handler and number of edges:
+ * 			handler,edges,cycles,cycles_per_edge
+ * 			handler - old (the driver before the flag-driven dispatch), callback (the event
+ * 				callback given to Initialize) or direct (the handlers set by ChannelSetHandler)
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "msf_config.h"
+#include "coredef.h"
+#include "msf.h"
+#include "drv_tpm.h"
+
+/* Number of calls of the handler for each result */
+#define		BENCH_RUNS		(1000000UL)
+/* Channels of TPM0 */
+#define		BENCH_CHANNELS	(6)
+
+/* The handlers compared by the benchmark */
+#define		BENCH_CALLBACK	(0)
+#define		BENCH_DIRECT	(1)
+
+/* The handler in the driver */
+extern void TPM0_IRQHandler(void);
+
+static volatile uint32_t g_sink;
+
+/* The time stamp; cycles on x86, ns elsewhere */
+static uint64_t bench_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/* Typical event callback: decodes the channel from the event mask */
+static void bench_event(uint32_t event, uint32_t arg)
+{
+	uint32_t channel;
+
+	if ( event == MSF_TPM_EVENT_TOF )
+		return;
+	for ( channel = 0; channel < BENCH_CHANNELS; channel++ )
+	{
+		if ( event == MSF_TPM_EVENT_CHN(channel) )
+		{
+			g_sink += arg + channel;
+			break;
+		}
+	}
+}
+
+#if !BENCH_OLD_DRIVER
+/* Direct channel handler; does the same work as bench_event */
+static void bench_channel(uint32_t channel, uint32_t value)
+{
+	g_sink += value + channel;
+}
+#endif
+
+/* Set the flags of the first n channels, as the timer does on n captured edges */
+static inline void bench_set_flags(uint8_t n)
+{
+	uint8_t ch;
+
+	for ( ch = 0; ch < n; ch++ )
+		TPM0->CONTROLS[ch].CnSC |= TPM_CnSC_CHF_MASK;
+	TPM0->STATUS = (1UL << n) - 1;
+}
+
+/* Measure the handler with the events of the first n channels pending;
+ * return the average number of cycles per call */
+static double bench_measure(uint8_t handler, uint8_t n)
+{
+	uint32_t run, ch;
+	uint64_t t, flags;
+
+	for ( ch = 0; ch < BENCH_CHANNELS; ch++ )
+	{
+		if ( ch < n )
+		{
+			Driver_TPM0.ChannelSetMode(ch, SWcompare, MSF_TPM_PARAM_CHANNEL_EVENT);
+			Driver_TPM0.ChannelWrite(ch, 100 + ch);
+#if !BENCH_OLD_DRIVER
+			Driver_TPM0.ChannelSetHandler(ch, (handler == BENCH_DIRECT) ? bench_channel : null);
+#endif
+		}
+		else
+			Driver_TPM0.ChannelSetMode(ch, Disabled, 0);
+	}
+
+	flags = bench_now();
+	for ( run = 0; run < BENCH_RUNS; run++ )
+	{
+		bench_set_flags(n);
+		g_sink += TPM0->STATUS;
+	}
+	flags = bench_now() - flags;
+
+	t = bench_now();
+	for ( run = 0; run < BENCH_RUNS; run++ )
+	{
+		bench_set_flags(n);
+		TPM0_IRQHandler();
+	}
+	t = bench_now() - t;
+
+	return (t > flags) ? (double)(t - flags) / BENCH_RUNS : 0;
+}
+
+int main(void)
+{
+#if BENCH_OLD_DRIVER
+	static const char* const names[] = { "old" };
+	const uint8_t last = BENCH_CALLBACK;
+#else
+	static const char* const names[] = { "callback", "direct" };
+	const uint8_t last = BENCH_DIRECT;
+#endif
+	uint8_t handler, n;
+	double cycles;
+
+	Driver_TPM0.Initialize(bench_event);
+	Driver_TPM0.Control(MSF_TPM_PRESCALER_SET | MSF_TPM_TOF_NO_SIGNAL, MSF_TPM_PRESCALER_1);
+
+	printf("handler,edges,cycles,cycles_per_edge\n");
+	for ( handler = BENCH_CALLBACK; handler <= last; handler++ )
+	{
+		for ( n = 1; n <= BENCH_CHANNELS; n++ )
+		{
+			cycles = bench_measure(handler, n);
+			printf("%s,%u,%.1f,%.1f\n", names[handler], n, cycles, cycles / n);
+		}
+	}
+
+	return (int)(g_sink & 0);
+}
@@ -0,0 +1,144 @@
+/****************************************************************************
+ * @file     tpm_test.c
+ * @brief    Host tests of the TPM driver: interrupt flags and DMA streams
+ * @version  1
+ * @date     19. Oct. 2026
+ *
+ * @note	Build and run on PC (from the root of MSF):
+ * 			gcc -std=gnu99 -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -DMSF_TPM_DMA=1
+ * 				-Itest/host/sim -Iexamples/kds/frdm_kl25z/tpm_timer/Includes -Iboard/frdm_kl25z
+ * 				-Iplatform/kinetis -Iplatform/kinetis/mkl25z -Icommon
+ * 				platform/kinetis/tpm_kl25.c test/host/sim/sim_mkl25z.c test/host/tpm_test.c -o tpm_test
+ * 			./tpm_test
+ * 			The program returns 0 if all the tests pass.
+ *
+ * 			The driver runs against the simulated registers (test/host/sim). The
+ * 			registers are plain memory, so the value the handler writes to STATUS
+ * 			(write 1 to clear) stays there and shows which flags it cleared.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "msf_config.h"
+#include "coredef.h"
+#include "msf.h"
+#include "drv_tpm.h"
+
+/* The handlers in the driver */
+extern void TPM0_IRQHandler(void);
+extern void DMA0_IRQHandler(void);
+
+static uint32_t g_events;
+static uint32_t g_stream_ends;
+static int g_failed;
+
+/* Circular tables must be aligned to their size */
+static uint16_t g_table[16] __attribute__((aligned(32)));
+
+static void test_check(const char* name, uint32_t value, uint32_t expected)
+{
+	if ( value != expected )
+	{
+		printf("FAIL %s: got 0x%lx, expected 0x%lx\n", name, (unsigned long)value, (unsigned long)expected);
+		g_failed++;
+	}
+	else
+		printf("ok   %s\n", name);
+}
+
+static void test_event(uint32_t event, uint32_t arg)
+{
+	g_events |= event;
+	if ( event & MSF_TPM_EVENT_STREAM_END )
+		g_stream_ends++;
+}
+
+/* The handler clears only the flags of the events it reports; not the flags
+ * which request the DMA transfers of a stream */
+static void test_flags(void)
+{
+	Driver_TPM0.Initialize(test_event);
+	Driver_TPM0.ChannelSetMode(1, SWcompare, MSF_TPM_PARAM_CHANNEL_EVENT);
+	Driver_TPM0.ChannelSetMode(2, SWcompare, MSF_TPM_PARAM_CHANNEL_EVENT);
+
+	TPM0->STATUS = TPM_STATUS_TOF_MASK | TPM_STATUS_CH1F_MASK | TPM_STATUS_CH3F_MASK;
+	TPM0_IRQHandler();
+	test_check("no stream: TOF and channel with event cleared", TPM0->STATUS,
+			TPM_STATUS_TOF_MASK | TPM_STATUS_CH1F_MASK);
+
+	/* stream on overflow: TOF requests the DMA */
+	Driver_TPM0.ChannelStream(2, g_table, 16, MSF_TPM_STREAM_ON_OVERFLOW);
+	TPM0->STATUS = TPM_STATUS_TOF_MASK | TPM_STATUS_CH1F_MASK;
+	TPM0_IRQHandler();
+	test_check("stream on overflow: TOF left for DMA", TPM0->STATUS, TPM_STATUS_CH1F_MASK);
+
+	/* stream on channel 2: its flag requests the DMA even if its event is enabled */
+	Driver_TPM0.ChannelStream(2, g_table, 16, MSF_TPM_STREAM_ON_CHANNEL);
+	TPM0->STATUS = TPM_STATUS_TOF_MASK | TPM_STATUS_CH1F_MASK | TPM_STATUS_CH2F_MASK;
+	TPM0_IRQHandler();
+	test_check("stream on channel: its flag left for DMA", TPM0->STATUS,
+			TPM_STATUS_TOF_MASK | TPM_STATUS_CH1F_MASK);
+
+	Driver_TPM0.ChannelStream(2, null, 0, 0);
+	TPM0->STATUS = TPM_STATUS_CH2F_MASK;
+	TPM0_IRQHandler();
+	test_check("stream stopped: flag cleared again", TPM0->STATUS, TPM_STATUS_CH2F_MASK);
+	Driver_TPM0.Uninitialize();
+}
+
+/* Circular streams use the modulo addressing of the DMA */
+static void test_circular(void)
+{
+	uint32_t bcr;
+
+	Driver_TPM0.Initialize(test_event);
+	Driver_TPM0.ChannelSetMode(0, OutCompare_toggle, 0);
+
+	test_check("circular: size not power of 2 rejected",
+			Driver_TPM0.ChannelStream(0, g_table, 12, MSF_TPM_STREAM_CIRCULAR), MSF_ERROR_ARGUMENT);
+	test_check("circular: less than 16 bytes rejected",
+			Driver_TPM0.ChannelStream(0, g_table, 4, MSF_TPM_STREAM_CIRCULAR), MSF_ERROR_ARGUMENT);
+	test_check("circular: unaligned table rejected",
+			Driver_TPM0.ChannelStream(0, &g_table[4], 8, MSF_TPM_STREAM_CIRCULAR), MSF_ERROR_ARGUMENT);
+
+	test_check("circular: 16 values accepted",
+			Driver_TPM0.ChannelStream(0, g_table, 16, MSF_TPM_STREAM_CIRCULAR), MSF_ERROR_OK);
+	/* 32 bytes: SMOD = 2; the request stays enabled at the end */
+	test_check("circular: SMOD for 32 bytes", DMA0->DMA[0].DCR & DMA_DCR_SMOD_MASK, DMA_DCR_SMOD(2));
+	test_check("circular: no D_REQ", DMA0->DMA[0].DCR & DMA_DCR_D_REQ_MASK, 0);
+	bcr = DMA0->DMA[0].DSR_BCR & DMA_DSR_BCR_BCR_MASK;
+	test_check("circular: counter is a multiple of the table", bcr % 32, 0);
+	test_check("circular: counter is the largest multiple", bcr, 0xFFFE0);
+
+	/* at the end of the counter: only the counter is set again */
+	DMA0->DMA[0].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	g_stream_ends = 0;
+	DMA0_IRQHandler();
+	test_check("circular: end event", g_stream_ends, 1);
+	test_check("circular: counter set again", DMA0->DMA[0].DSR_BCR & DMA_DSR_BCR_BCR_MASK, 0xFFFE0);
+	test_check("circular: request still enabled", DMA0->DMA[0].DCR & DMA_DCR_ERQ_MASK, DMA_DCR_ERQ_MASK);
+
+	/* one-shot: the request is disabled at the end of the table and the stream stops */
+	test_check("one-shot: any size",
+			Driver_TPM0.ChannelStream(0, g_table, 12, MSF_TPM_STREAM_ON_CHANNEL), MSF_ERROR_OK);
+	test_check("one-shot: counter is the table", DMA0->DMA[0].DSR_BCR & DMA_DSR_BCR_BCR_MASK, 24);
+	test_check("one-shot: D_REQ, no SMOD", DMA0->DMA[0].DCR & (DMA_DCR_D_REQ_MASK | DMA_DCR_SMOD_MASK),
+			DMA_DCR_D_REQ_MASK);
+	DMA0_IRQHandler();
+	test_check("one-shot: stopped at the end", DMA0->DMA[0].DCR, 0);
+	Driver_TPM0.Uninitialize();
+}
+
+int main(void)
+{
+	test_flags();
+	test_circular();
+
+	if ( g_failed )
+		printf("%d test(s) FAILED\n", g_failed);
+	else
+		printf("All tests passed\n");
+	return g_failed ? 1 : 0;
+}